@@ -0,0 +1,42 @@
+#include "AllocCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+// 替换全局 operator new / delete 以统计分配次数，只多一次 relaxed fetch_add
+// 对齐版本 (align_val_t) 未替换，不计入统计
+
+namespace {
+
+std::atomic<uint64_t> gAllocCount{0};
+std::atomic<uint64_t> gAllocBytes{0};
+
+void* countedAlloc(std::size_t size) {
+    gAllocCount.fetch_add(1, std::memory_order_relaxed);
+    gAllocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+} // namespace
+
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void  operator delete(void* ptr) noexcept { std::free(ptr); }
+void  operator delete[](void* ptr) noexcept { std::free(ptr); }
+void  operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void  operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+
+namespace ldapi::bench {
+
+AllocStats allocSnapshot() {
+    return {gAllocCount.load(std::memory_order_relaxed), gAllocBytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdint>
+
+
+namespace ldapi::bench {
+
+struct AllocStats {
+    uint64_t count;
+    uint64_t bytes;
+};
+
+/// 进程启动以来经全局 operator new 分配的次数与字节数 (AllocCounter.cc 替换了全局 new / delete)
+AllocStats allocSnapshot();
+
+} // namespace ldapi::bench
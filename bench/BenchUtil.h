@@ -0,0 +1,35 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+
+namespace ldapi::bench {
+
+inline volatile int64_t gSink = 0; // 防止编译器消除被测代码
+
+template <typename F>
+double nsPerOp(int iterations, F&& fn) {
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / iterations;
+}
+
+// 按倍增的次数重复执行，直到单轮耗时超过 minTime，返回每次调用的平均纳秒
+template <typename F>
+double measure(F&& fn, std::chrono::milliseconds minTime = std::chrono::milliseconds{200}) {
+    for (int iterations = 1;; iterations *= 2) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            fn(i);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - begin;
+        if (elapsed >= minTime || iterations >= (1 << 28)) {
+            return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+        }
+    }
+}
+
+} // namespace ldapi::bench
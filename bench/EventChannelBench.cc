@@ -0,0 +1,110 @@
+#include "fmt/core.h"
+
+#include "BenchUtil.h"
+#include "SyntheticLands.h"
+
+#include "ll/api/coro/CoroTask.h"
+#include "ll/api/event/EventBus.h"
+#include "mc/world/actor/player/Player.h"
+#include "pland/events/Events.h"
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// 真实的 EventChannel / ScriptEventManager: 经 Event_RegisterListenerEx 注册脚本回调，发布 PlayerEnterLandEvent
+
+namespace {
+
+using namespace ldapi;
+using namespace ldapi::bench;
+
+constexpr char const* EventName = "PlayerEnterLandEvent";
+
+int64_t gDelivered = 0;
+
+struct Listeners {
+    std::vector<int> handles;
+
+    ~Listeners() {
+        auto remove = importExport<bool(int)>("Event_RemoveListener");
+        for (auto handle : handles) {
+            remove(handle);
+        }
+    }
+};
+
+void addListeners(Listeners& out, int count, std::string const& options) {
+    auto genID     = importExport<std::string()>("ScriptEventManager_genListenerID");
+    auto register_ = importExport<int(std::string const&, std::string const&, std::string const&)>(
+        "Event_RegisterListenerEx"
+    );
+    for (int i = 0; i < count; ++i) {
+        auto id = genID();
+        RemoteCall::exportAs(EventName, id, std::function<bool(Player*, int)>{[](Player*, int landId) {
+                                 gDelivered += landId;
+                                 return true;
+                             }});
+        auto handle = register_(EventName, id, options);
+        if (handle == -1) {
+            throw std::runtime_error{fmt::format("failed to register listener: {}", options)};
+        }
+        out.handles.push_back(handle);
+    }
+}
+
+void row(std::string const& name, double ns) { fmt::print("{:<44} {:>12.1f}\n", name, ns); }
+
+} // namespace
+
+
+namespace ldapi::bench {
+
+void benchEventChannel() {
+    growRegistry(1000);
+
+    Player player;
+    player.uuid = syntheticPlayer(0);
+
+    auto& bus     = ll::event::EventBus::getInstance();
+    auto  publish = [&](int i) {
+        land::event::PlayerEnterLandEvent ev{&player, static_cast<land::LandID>(i % 1000)};
+        bus.publish(ev);
+    };
+
+    fmt::print("{:<44} {:>12}\n", "PlayerEnterLandEvent", "ns/publish");
+    {
+        Listeners listeners;
+        addListeners(listeners, 1, R"({"owner":"bench"})");
+        row("1 listener", measure(publish));
+    }
+    {
+        Listeners listeners;
+        addListeners(listeners, 8, R"({"owner":"bench"})");
+        row("8 listeners", measure(publish));
+    }
+    {
+        // 只关心 2 块领地，其余事件在参数转换前被过滤
+        Listeners listeners;
+        addListeners(listeners, 8, R"({"owner":"bench","filter":{"lands":[1,2]}})");
+        row("8 listeners, filter 2 of 1000 lands", measure(publish));
+    }
+    {
+        // 发布只入队，tick 时投递；每 256 次发布推进一次 tick
+        Listeners listeners;
+        addListeners(listeners, 8, R"({"owner":"bench","deferred":{"capacity":4096}})");
+        auto& scheduler = ll::coro::TickScheduler::getInstance();
+        row("8 listeners, deferred (incl. tick drain)", measure([&](int i) {
+                publish(i);
+                if ((i & 255) == 255) {
+                    scheduler.tick();
+                }
+            }));
+        scheduler.tick();
+    }
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,83 @@
+#include "fmt/core.h"
+
+#include "BenchUtil.h"
+#include "SyntheticLands.h"
+
+#include "ll/api/event/EventBus.h"
+#include "mc/world/actor/player/Player.h"
+#include "pland/events/Events.h"
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+
+// 事件派发开销: 经真实的 ScriptEventManager / EventChannel 发布 PlayerEnterLandEvent
+// 旧式注册 (Event_RegisterListener，不知道所属脚本) 每次派发前 hasFunc，
+// 指定所属脚本的注册 (Event_RegisterListenerEx，LDEvent.listen 现在走这条路径) 派发时不做检查，脚本卸载后按 tick 移除
+
+namespace {
+
+using namespace ldapi;
+using namespace ldapi::bench;
+
+constexpr char const* EventName = "PlayerEnterLandEvent";
+constexpr int         Exports   = 512; // 服务器上其他脚本导出的函数
+
+int64_t gDelivered = 0;
+
+std::string exportCallback() {
+    auto id = importExport<std::string()>("ScriptEventManager_genListenerID")();
+    RemoteCall::exportAs(EventName, id, std::function<bool(Player*, int)>{[](Player*, int landId) {
+                             gDelivered += landId;
+                             return true;
+                         }});
+    return id;
+}
+
+} // namespace
+
+
+namespace ldapi::bench {
+
+void benchEventDispatch() {
+    growRegistry(1000);
+    for (int i = 0; i < Exports; ++i) {
+        RemoteCall::exportAs("OtherPlugin", fmt::format("func_{}", i), std::function<bool()>{[] { return true; }});
+    }
+
+    Player player;
+    player.uuid = syntheticPlayer(0);
+
+    auto& bus     = ll::event::EventBus::getInstance();
+    auto  publish = [&](int i) {
+        land::event::PlayerEnterLandEvent ev{&player, static_cast<land::LandID>(i % 1000)};
+        bus.publish(ev);
+    };
+    auto remove = importExport<bool(int)>("Event_RemoveListener");
+
+    // 旧式注册不返回句柄，测完后删除导出函数使监听器失效，下次派发时由通道移除
+    auto legacyID = exportCallback();
+    if (!importExport<bool(std::string const&, std::string const&)>("Event_RegisterListener")(EventName, legacyID)) {
+        throw std::runtime_error{"failed to register legacy listener"};
+    }
+    auto legacy = measure(publish);
+    RemoteCall::removeFunc(EventName, legacyID);
+    publish(0);
+
+    auto ownedID = exportCallback();
+    auto handle  = importExport<int(std::string const&, std::string const&, std::string const&)>(
+        "Event_RegisterListenerEx"
+    )(EventName, ownedID, R"({"owner":"bench"})");
+    if (handle == -1) {
+        throw std::runtime_error{"failed to register owned listener"};
+    }
+    auto owned = measure(publish);
+    remove(handle);
+
+    fmt::print("{:<24} {:>12} {:>12} {:>10}\n", "ns/publish", "hasFunc", "owner", "speedup");
+    fmt::print("{:<24} {:>12.1f} {:>12.1f} {:>9.2f}x\n", EventName, legacy, owned, legacy / owned);
+}
+
+} // namespace ldapi::bench
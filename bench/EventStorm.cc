@@ -0,0 +1,334 @@
+#include "fmt/core.h"
+#include "fmt/os.h"
+
+#include "AllocCounter.h"
+#include "SyntheticLands.h"
+
+#include "ll/api/coro/CoroTask.h"
+#include "ll/api/event/EventBus.h"
+#include "mc/world/actor/player/Player.h"
+#include "pland/PLand.h"
+#include "pland/events/Events.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// 事件风暴回放压测: 玩家成群移动时 PlayerEnterLandEvent / PlayerLeaveLandEvent 经 EventChannel 投递给脚本回调
+// 事件序列可以合成 (玩家在合成领地网格上随机行走)，也可以从文件回放
+// 脚本回调以忙等模拟执行耗时；LegacyRemoteCall 的参数转换由 stubs 中的 RemoteCall 代替，不计入分配统计
+
+namespace {
+
+using namespace ldapi;
+using namespace ldapi::bench;
+
+using Clock = std::chrono::steady_clock;
+
+struct StormConfig {
+    size_t      lands{10'000};
+    size_t      players{200};
+    int         ticks{1200};
+    double      speed{1.0};   // 方块/tick，疾跑约 0.28，鞘翅约 1.5 ~ 3
+    int         listeners{4}; // 脚本数量，每个脚本同时监听进入与离开
+    int64_t     costNs{0};    // 每次脚本回调的耗时
+    bool        deferred{false};
+    std::string replay; // 回放的事件文件
+    std::string record; // 将合成的事件写入文件
+};
+
+enum class StormEvent : int { Enter = 0, Leave = 1 };
+
+// 文件格式: 每行 "tick,event,player,landId"，event 为 0 (进入) 或 1 (离开)
+struct StormRecord {
+    int          tick;
+    StormEvent   event;
+    int          player;
+    land::LandID landId;
+};
+
+int64_t gDelivered = 0;
+
+void spin(int64_t ns) {
+    if (ns <= 0) {
+        return;
+    }
+    auto until = Clock::now() + std::chrono::nanoseconds{ns};
+    while (Clock::now() < until) {}
+}
+
+bool parseConfig(int argc, char** argv, StormConfig& out) {
+    for (int i = 0; i + 1 < argc; i += 2) {
+        std::string_view key   = argv[i];
+        char const*      value = argv[i + 1];
+        if (key == "--lands") {
+            out.lands = std::strtoull(value, nullptr, 10);
+        } else if (key == "--players") {
+            out.players = std::strtoull(value, nullptr, 10);
+        } else if (key == "--ticks") {
+            out.ticks = std::atoi(value);
+        } else if (key == "--speed") {
+            out.speed = std::atof(value);
+        } else if (key == "--listeners") {
+            out.listeners = std::atoi(value);
+        } else if (key == "--cost-ns") {
+            out.costNs = std::atoll(value);
+        } else if (key == "--deferred") {
+            out.deferred = std::string_view{value} == "1";
+        } else if (key == "--replay") {
+            out.replay = value;
+        } else if (key == "--record") {
+            out.record = value;
+        } else {
+            return false;
+        }
+    }
+    return argc % 2 == 0 && out.players > 0 && out.ticks > 0;
+}
+
+/**
+ * 合成移动风暴: 玩家从主世界的领地中心出发，保持方向随机行走
+ * 每 tick 按 getLandAt 判断所在领地，变化时依次产生离开 / 进入事件 (与 PLand 的检测方式相同)
+ */
+std::vector<StormRecord> synthesize(StormConfig const& config) {
+    growRegistry(config.lands);
+    auto& registry = land::PLand::getInstance().getLandRegistry();
+
+    struct Walker {
+        double       x, z, heading;
+        land::LandID current;
+    };
+
+    std::mt19937_64                        rng{7};
+    std::uniform_real_distribution<double> turn{-0.3, 0.3};
+    std::vector<Walker>                    walkers;
+    for (size_t i = 0; i < config.players; ++i) {
+        size_t index;
+        do {
+            index = rng() % config.lands;
+        } while (syntheticDimension(index) != 0);
+        auto center = syntheticCenter(index);
+        auto land   = registry.getLandAt(center, 0);
+        walkers.push_back({
+            static_cast<double>(center.x),
+            static_cast<double>(center.z),
+            std::uniform_real_distribution<double>{0, 2 * std::numbers::pi}(rng),
+            land ? land->getId() : land::INVALID_LAND_ID
+        });
+    }
+
+    std::vector<StormRecord> records;
+    for (int tick = 0; tick < config.ticks; ++tick) {
+        for (size_t i = 0; i < walkers.size(); ++i) {
+            auto& walker    = walkers[i];
+            walker.heading += turn(rng);
+            walker.x       += std::cos(walker.heading) * config.speed;
+            walker.z       += std::sin(walker.heading) * config.speed;
+
+            BlockPos pos{static_cast<int>(std::floor(walker.x)), 64, static_cast<int>(std::floor(walker.z))};
+            auto     land = registry.getLandAt(pos, 0);
+            auto     id   = land ? land->getId() : land::INVALID_LAND_ID;
+            if (id == walker.current) {
+                continue;
+            }
+            if (walker.current != land::INVALID_LAND_ID) {
+                records.push_back({tick, StormEvent::Leave, static_cast<int>(i), walker.current});
+            }
+            if (id != land::INVALID_LAND_ID) {
+                records.push_back({tick, StormEvent::Enter, static_cast<int>(i), id});
+            }
+            walker.current = id;
+        }
+    }
+    return records;
+}
+
+std::vector<StormRecord> load(std::string const& path) {
+    std::ifstream in{path};
+    if (!in) {
+        throw std::runtime_error{fmt::format("cannot open {}", path)};
+    }
+    std::vector<StormRecord> records;
+    std::string              line;
+    while (std::getline(in, line)) {
+        StormRecord record{};
+        int         event;
+        long long   landId;
+        if (std::sscanf(line.c_str(), "%d,%d,%d,%lld", &record.tick, &event, &record.player, &landId) != 4) {
+            continue;
+        }
+        record.event  = static_cast<StormEvent>(event);
+        record.landId = static_cast<land::LandID>(landId);
+        records.push_back(record);
+    }
+    return records;
+}
+
+void save(std::string const& path, std::vector<StormRecord> const& records) {
+    auto out = fmt::output_file(path);
+    for (auto const& record : records) {
+        out.print("{},{},{},{}\n", record.tick, static_cast<int>(record.event), record.player, record.landId);
+    }
+}
+
+std::vector<int> registerListeners(StormConfig const& config) {
+    auto genID     = importExport<std::string()>("ScriptEventManager_genListenerID");
+    auto register_ = importExport<int(std::string const&, std::string const&, std::string const&)>(
+        "Event_RegisterListenerEx"
+    );
+    auto options = config.deferred ? R"({"owner":"bench","deferred":{"capacity":65536}})" : R"({"owner":"bench"})";
+    auto costNs  = config.costNs;
+
+    std::vector<int> handles;
+    for (int i = 0; i < config.listeners; ++i) {
+        for (auto eventName : {"PlayerEnterLandEvent", "PlayerLeaveLandEvent"}) {
+            auto id = genID();
+            RemoteCall::exportAs(eventName, id, std::function<bool(Player*, int)>{[costNs](Player*, int landId) {
+                                     spin(costNs);
+                                     gDelivered += landId;
+                                     return true;
+                                 }});
+            auto handle = register_(eventName, id, options);
+            if (handle == -1) {
+                throw std::runtime_error{fmt::format("failed to register {} listener", eventName)};
+            }
+            handles.push_back(handle);
+        }
+    }
+    return handles;
+}
+
+double percentile(std::vector<int64_t> const& sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+    return static_cast<double>(sorted[index]);
+}
+
+} // namespace
+
+
+namespace ldapi::bench {
+
+/**
+ * 用法: bench storm [--lands N] [--players N] [--ticks N] [--speed blocks] [--listeners N] [--cost-ns N]
+ *                   [--deferred 0|1] [--replay file] [--record file]
+ */
+int runEventStorm(int argc, char** argv) {
+    StormConfig config;
+    if (!parseConfig(argc, argv, config)) {
+        fmt::print(stderr, "invalid storm arguments\n");
+        return 1;
+    }
+
+    auto records = config.replay.empty() ? synthesize(config) : load(config.replay);
+    if (!config.record.empty()) {
+        save(config.record, records);
+    }
+    if (records.empty()) {
+        fmt::print("no events to replay\n");
+        return 0;
+    }
+
+    int maxPlayer = 0;
+    int lastTick  = 0;
+    for (auto const& record : records) {
+        maxPlayer = std::max(maxPlayer, record.player);
+        lastTick  = std::max(lastTick, record.tick);
+    }
+    std::vector<Player> players(static_cast<size_t>(maxPlayer) + 1);
+    for (size_t i = 0; i < players.size(); ++i) {
+        players[i].uuid = syntheticPlayer(i);
+    }
+
+    auto  handles   = registerListeners(config);
+    auto  removeFn  = importExport<bool(int)>("Event_RemoveListener");
+    auto& bus       = ll::event::EventBus::getInstance();
+    auto& scheduler = ll::coro::TickScheduler::getInstance();
+    auto  toNs      = [](Clock::duration duration) {
+        return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+
+    std::vector<int64_t> latencies;
+    std::vector<int64_t> tickTimes; // 每个有事件的 tick: 发布 + 延迟投递的总耗时
+    latencies.reserve(records.size());
+    tickTimes.reserve(static_cast<size_t>(lastTick) + 1);
+
+    auto allocBefore = allocSnapshot();
+    auto begin       = Clock::now();
+    auto tickBegin   = begin;
+    int  tick        = records.front().tick;
+    auto endTick     = [&]() {
+        scheduler.tick();
+        auto now = Clock::now();
+        tickTimes.push_back(toNs(now - tickBegin));
+        tickBegin = now;
+    };
+    for (auto const& record : records) {
+        if (record.tick != tick) {
+            endTick();
+            tick = record.tick;
+        }
+        auto  start  = Clock::now();
+        auto* player = &players[static_cast<size_t>(record.player)];
+        if (record.event == StormEvent::Enter) {
+            land::event::PlayerEnterLandEvent ev{player, record.landId};
+            bus.publish(ev);
+        } else {
+            land::event::PlayerLeaveLandEvent ev{{player, record.landId}};
+            bus.publish(ev);
+        }
+        latencies.push_back(toNs(Clock::now() - start));
+    }
+    endTick();
+    auto elapsed    = Clock::now() - begin;
+    auto allocAfter = allocSnapshot();
+
+    for (auto handle : handles) {
+        removeFn(handle);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto events  = static_cast<double>(records.size());
+    auto seconds = std::chrono::duration<double>(elapsed).count();
+
+    fmt::print(
+        "storm: {} events in {} ticks, {} listeners x 2 events, callback {} ns, {}\n",
+        records.size(),
+        tickTimes.size(),
+        config.listeners,
+        config.costNs,
+        config.deferred ? "deferred" : "synchronous"
+    );
+    fmt::print("{:<28} {:>14.0f}\n", "events/s", events / seconds);
+    fmt::print("{:<28} {:>14.0f}\n", "publish p50 ns", percentile(latencies, 0.50));
+    fmt::print("{:<28} {:>14.0f}\n", "publish p99 ns", percentile(latencies, 0.99));
+    fmt::print("{:<28} {:>14.0f}\n", "publish p99.9 ns", percentile(latencies, 0.999));
+    fmt::print("{:<28} {:>14.0f}\n", "publish max ns", static_cast<double>(latencies.back()));
+    fmt::print(
+        "{:<28} {:>14.2f}\n",
+        "max tick ms",
+        static_cast<double>(*std::max_element(tickTimes.begin(), tickTimes.end())) / 1e6
+    );
+    auto allocs = static_cast<double>(allocAfter.count - allocBefore.count);
+    auto bytes  = static_cast<double>(allocAfter.bytes - allocBefore.bytes);
+    fmt::print("{:<28} {:>14.2f}\n", "allocs/event", allocs / events);
+    fmt::print("{:<28} {:>14.1f}\n", "alloc bytes/event", bytes / events);
+    return 0;
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,58 @@
+#include "exports/FfiProtocol.h"
+
+#include "fmt/core.h"
+
+#include "BenchUtil.h"
+
+#include <cstdint>
+#include <string>
+
+
+namespace {
+
+using namespace ldapi;
+using namespace ldapi::bench;
+
+// JSON 协议: 导出侧 dump + 脚本侧 JSON.parse (以 nlohmann::json::parse 近似)
+template <typename T>
+int64_t roundTripJson(FfiResult<T> const& result) {
+    FfiProtocol    protocol = ffi_encode_json(result);
+    nlohmann::json payload  = nlohmann::json::parse(protocol);
+    if (!payload["ok"].get<bool>()) {
+        return static_cast<int64_t>(payload["error"].get_ref<std::string const&>().size());
+    }
+    return payload.contains("value") ? payload["value"].get<int64_t>() : 1;
+}
+
+// 原生协议: 导出侧构造数组 + 脚本侧按下标读取，失败时额外取回错误信息
+template <typename T>
+int64_t roundTripNative(FfiResult<T> const& result) {
+    FfiNativeProtocol protocol = ffi_encode_native(result);
+    if (protocol[0] != static_cast<int64_t>(FfiStatus::Ok)) {
+        return static_cast<int64_t>(FfiErrorTable::getInstance().get(static_cast<int>(protocol[1])).size());
+    }
+    return protocol.size() > 2 ? protocol[2] : 1;
+}
+
+template <typename Make>
+void compare(char const* name, int iterations, Make&& make) {
+    auto json   = nsPerOp(iterations, [&](int i) { gSink = gSink + roundTripJson(make(i)); });
+    auto native = nsPerOp(iterations, [&](int i) { gSink = gSink + roundTripNative(make(i)); });
+    fmt::print("{:<24} {:>12.1f} {:>12.1f} {:>9.1f}x\n", name, json, native, json / native);
+}
+
+} // namespace
+
+
+namespace ldapi::bench {
+
+void benchFfiProtocol() {
+    constexpr int Iterations = 1'000'000;
+
+    fmt::print("{:<24} {:>12} {:>12} {:>10}\n", "case", "json ns/op", "native ns/op", "speedup");
+    compare("success<void>", Iterations, [](int) { return ffi_success(); });
+    compare("success<LandID>", Iterations, [](int i) { return ffi_success(static_cast<int64_t>(i)); });
+    compare("error", Iterations, [](int i) -> FfiResult<> { return ffi_error("land [{}] not found", i); });
+}
+
+} // namespace ldapi::bench
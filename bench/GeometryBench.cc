@@ -0,0 +1,71 @@
+#include "fmt/core.h"
+
+#include "BenchUtil.h"
+#include "SyntheticLands.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// 范围 / 边框生成: 一次性返回全部坐标 (getRange / getBorder) vs 游标分段与线段编码
+
+namespace {
+
+using namespace ldapi;
+using namespace ldapi::bench;
+
+struct Box {
+    char const* name;
+    BlockPos    min, max;
+};
+
+} // namespace
+
+
+namespace ldapi::bench {
+
+void benchGeometry() {
+    auto getRange       = importExport<std::vector<IntPos>(IntPos, IntPos)>("LandAABB_getRange");
+    auto getBorder      = importExport<std::vector<IntPos>(IntPos, IntPos)>("LandAABB_getBorder");
+    auto openRange      = importExport<int(IntPos, IntPos)>("LandAABB_openRange");
+    auto nextRangeRuns  = importExport<std::vector<std::vector<int>>(int, int)>("LandAABB_nextRangeRuns");
+    auto borderSegments =
+        importExport<std::vector<std::vector<int>>(IntPos, IntPos, int)>("LandAABB_getBorderSegments");
+
+    Box boxes[] = {
+        {"16x16x16",    {0, 0, 0},   {15, 15, 15}  },
+        {"64x64x64",    {0, 0, 0},   {63, 63, 63}  },
+        {"32x384x32",   {0, -64, 0}, {31, 319, 31} },
+        {"256x384x256", {0, -64, 0}, {255, 319, 255}},
+    };
+    auto us = [](double ns) { return ns < 0 ? std::string{"-"} : fmt::format("{:.1f}", ns / 1000.0); };
+
+    fmt::print("{:<28} {:>14} {:>14} {:>14} {:>14}\n", "box", "range us", "runs us", "border us", "segments us");
+    for (auto& box : boxes) {
+        IntPos a{box.min, 0};
+        IntPos b{box.max, 0};
+
+        // 一次性返回数千万个坐标在真实服务器上不可行，大范围只测分段接口
+        auto   volume = int64_t{box.max.x - box.min.x + 1} * (box.max.y - box.min.y + 1) * (box.max.z - box.min.z + 1);
+        double range  = -1;
+        if (volume <= 4'000'000) {
+            range = measure([&](int) { gSink = gSink + static_cast<int64_t>(getRange(a, b).size()); });
+        }
+
+        auto runs = measure([&](int) {
+            auto handle = openRange(a, b);
+            while (true) {
+                auto chunk = nextRangeRuns(handle, 16384);
+                if (chunk.empty()) break;
+                gSink = gSink + static_cast<int64_t>(chunk.size());
+            }
+        });
+        auto border   = measure([&](int) { gSink = gSink + static_cast<int64_t>(getBorder(a, b).size()); });
+        auto segments = measure([&](int) { gSink = gSink + static_cast<int64_t>(borderSegments(a, b, 1).size()); });
+
+        fmt::print("{:<28} {:>14} {:>14} {:>14} {:>14}\n", box.name, us(range), us(runs), us(border), us(segments));
+    }
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,54 @@
+#include "fmt/core.h"
+
+#include "SyntheticLands.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <string_view>
+
+
+namespace ldapi::bench {
+
+void benchFfiProtocol();
+void benchEventDispatch();
+void benchEventChannel();
+void benchGeometry();
+void benchPermTable(size_t lands);
+void benchRegistryQueries(size_t lands);
+int  runEventStorm(int argc, char** argv);
+
+} // namespace ldapi::bench
+
+
+// 用法: bench [最大领地数量]，默认 1'000'000
+//       bench storm [选项]，事件风暴回放压测，选项见 runEventStorm
+int main(int argc, char** argv) {
+    using namespace ldapi::bench;
+
+    if (argc > 1 && std::string_view{argv[1]} == "storm") {
+        registerExports();
+        return runEventStorm(argc - 2, argv + 2);
+    }
+
+    size_t maxLands = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+
+    registerExports();
+
+    benchFfiProtocol();
+    fmt::print("\n");
+    benchEventDispatch();
+    fmt::print("\n");
+    benchEventChannel();
+    fmt::print("\n");
+    benchGeometry();
+    fmt::print("\n");
+    benchPermTable(10'000);
+    for (size_t lands : {10'000, 100'000, 1'000'000}) {
+        if (lands > maxLands) {
+            break;
+        }
+        fmt::print("\n");
+        benchRegistryQueries(lands);
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "fmt/core.h"
+
+#include "exports/APIHelper.h"
+#include "exports/LandHandles.h"
+#include "exports/PermCache.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include "BenchUtil.h"
+#include "SyntheticLands.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+// 权限表序列化: 每次反射序列化 (旧) vs PermTableCache 命中 (新)，以及批量快照
+
+namespace ldapi::bench {
+
+void benchPermTable(size_t lands) {
+    growRegistry(lands);
+
+    auto& registry       = land::PLand::getInstance().getLandRegistry();
+    auto  getPermTable   = importExport<std::string(LandRef)>("Land_getPermTable");
+    auto  getSnapshots   = importExport<std::string(std::vector<LandRef>, int)>("Land_getSnapshots");
+    auto  checkPerm      = importExport<int(IntPos, std::string const&, std::string const&)>("Land_checkPerm");
+    auto  getHandle      = importExport<LandRef(LandRef)>("Land_getHandle");
+    auto  permTableField = 1 << 16; // LandSnapshotField::PermTable
+
+    std::vector<LandRef> ids(100);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ids[i] = static_cast<LandRef>(i * (lands / ids.size()));
+    }
+    auto mod = static_cast<int>(lands);
+
+    fmt::print("{:<36} {:>12}\n", "case", "ns/op");
+
+    auto ns = measure([&](int i) {
+        auto land = registry.getLand(i % mod);
+        gSink     = gSink + static_cast<int64_t>(toLSE<land::LandPermTable>(land->getPermTable()).size());
+    });
+    fmt::print("{:<36} {:>12.1f}\n", "serialize (uncached)", ns);
+
+    // 依次访问全部领地: 超过容量时每次都淘汰即将再次访问的条目 (LRU 的最坏情况)
+    ns = measure([&](int i) { gSink = gSink + static_cast<int64_t>(getPermTable(i % mod).size()); });
+    fmt::print("{:<36} {:>12.1f}\n", "Land_getPermTable (sweep all)", ns);
+
+    auto hot = std::min(mod, static_cast<int>(PermTableCache::MaxEntries));
+    ns       = measure([&](int i) { gSink = gSink + static_cast<int64_t>(getPermTable(i % hot).size()); });
+    fmt::print("{:<36} {:>12.1f}\n", fmt::format("Land_getPermTable (hot {})", hot), ns);
+
+    ns = measure([&](int i) { gSink = gSink + static_cast<int64_t>(getPermTable(i % 256).size()); });
+    fmt::print("{:<36} {:>12.1f}\n", "Land_getPermTable (hot 256)", ns);
+
+    std::vector<LandRef> handles(256);
+    for (int i = 0; i < 256; ++i) {
+        handles[i] = getHandle(i);
+    }
+    ns = measure([&](int i) { gSink = gSink + static_cast<int64_t>(getPermTable(handles[i & 255]).size()); });
+    fmt::print("{:<36} {:>12.1f}\n", "Land_getPermTable (hot 256, handle)", ns);
+
+    ns = measure([&](int) { gSink = gSink + static_cast<int64_t>(getSnapshots(ids, permTableField).size()); });
+    fmt::print("{:<36} {:>12.1f}\n", "Land_getSnapshots (100, perm)", ns / 100);
+
+    auto visitor = syntheticPlayer(SyntheticPlayers - 1).asString();
+    ns = measure([&](int i) {
+        auto index = static_cast<size_t>(i % mod);
+        auto pos   = IntPos{syntheticCenter(index), syntheticDimension(index)};
+        gSink      = gSink + checkPerm(pos, visitor, "allowPlace");
+    });
+    fmt::print("{:<36} {:>12.1f}\n", "Land_checkPerm", ns);
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,146 @@
+#include "fmt/core.h"
+
+#include "BenchUtil.h"
+#include "ScriptBoundary.h"
+#include "SyntheticLands.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include "exports/LandHandles.h"
+#include "exports/LandObserver.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// LandRegistry_getLands* / getLandAt 的导出层开销 (查询 + SharedLand -> LandID 转换)，随领地总数变化
+
+namespace {
+
+using namespace ldapi;
+using namespace ldapi::bench;
+
+using LandList = std::vector<land::LandID>;
+
+void recreateFirstLand(land::LandID id) {
+    auto& registry = land::PLand::getInstance().getLandRegistry();
+    auto  old      = registry.getLand(id);
+    (void)registry.removeOrdinaryLand(old);
+    LandObserver::getInstance().notify({id, LandChangeKind::Removed});
+
+    auto land = land::Land::make(old->getAABB(), old->getDimensionId(), old->is3D(), old->getOwner());
+    if (registry.addOrdinaryLand(land)) {
+        LandObserver::getInstance().notify({land->getId(), LandChangeKind::Created});
+    }
+}
+
+void row(std::string const& name, double ns, size_t items) {
+    fmt::print(
+        "{:<36} {:>12.1f} {:>10} {:>12.2f}\n",
+        name,
+        ns / 1000.0,
+        items,
+        items == 0 ? 0.0 : ns / static_cast<double>(items)
+    );
+}
+
+} // namespace
+
+
+namespace ldapi::bench {
+
+void benchRegistryQueries(size_t lands) {
+    growRegistry(lands);
+
+    auto getLands  = importExport<LandList()>("LandRegistry_getLands");
+    auto getLands1 = importExport<LandList(int)>("LandRegistry_getLands1");
+    auto getLands2 = importExport<LandList(std::string const&, bool)>("LandRegistry_getLands2");
+    auto getLands3 = importExport<LandList(std::string const&, int)>("LandRegistry_getLands3");
+    auto getLands4 = importExport<LandList(std::vector<LandRef>)>("LandRegistry_getLands4");
+    auto getLandAt = importExport<land::LandID(IntPos)>("LandRegistry_getLandAt");
+    auto getGen    = importExport<int64_t()>("LandRegistry_getGeneration");
+
+    using ConflictsFn  = std::vector<int64_t>(IntPos, IntPos, int, bool, std::vector<LandRef>);
+    using SpacingFn    = bool(IntPos, IntPos, IntPos, IntPos, int, bool);
+    // 圈地校验的两种做法都由脚本发起，经 ScriptBoundary 计入每次调用的参数 / 返回值往返
+    auto getLandAt2    = importFromScript<LandList(IntPos, IntPos)>("LandRegistry_getLandAt2");
+    auto getAABB       = importFromScript<std::vector<IntPos>(LandRef)>("Land_getAABB");
+    auto isComplis     = importFromScript<SpacingFn>("LandAABB_isComplisWithMinSpacing");
+    auto findConflicts = importFromScript<ConflictsFn>("LandRegistry_findConflicts");
+
+    // 之前的规模中重建过领地，ID 不一定连续，从现有 ID 中抽取
+    std::mt19937_64      rng{42};
+    auto                 allIds = getLands();
+    std::vector<LandRef> someIds(1000);
+    for (auto& id : someIds) {
+        id = allIds[rng() % allIds.size()];
+    }
+    auto owner = syntheticPlayer(1).asString();
+
+    size_t items = 0;
+    fmt::print("-- {} lands\n", lands);
+    fmt::print("{:<36} {:>12} {:>10} {:>12}\n", "export", "us/call", "items", "ns/item");
+
+    auto ns = measure([&](int) { items = getLands().size(); });
+    row("LandRegistry_getLands()", ns, items);
+
+    ns = measure([&](int) { items = getLands1(0).size(); });
+    row("LandRegistry_getLands1(dimid)", ns, items);
+
+    ns = measure([&](int) { gSink = gSink + getGen(); });
+    row("LandRegistry_getGeneration()", ns, 1);
+
+    ns = measure([&](int) { items = getLands2(owner, true).size(); });
+    row("LandRegistry_getLands2(uuid, shared)", ns, items);
+
+    ns = measure([&](int) { items = getLands3(owner, 0).size(); });
+    row("LandRegistry_getLands3(uuid, dimid)", ns, items);
+
+    ns = measure([&](int) { items = getLands4(someIds).size(); });
+    row("LandRegistry_getLands4(1000 ids)", ns, items);
+
+    std::vector<IntPos> probes;
+    for (int i = 0; i < 4096; ++i) {
+        auto index = rng() % lands;
+        probes.emplace_back(syntheticCenter(index), syntheticDimension(index));
+    }
+    ns = measure([&](int i) { gSink = gSink + getLandAt(probes[i & 4095]); });
+    row("LandRegistry_getLandAt(pos)", ns, 1);
+
+    // 圈地校验: 在相邻领地之间拟建 40x40 的领地，最小间距 16
+    constexpr int MinSpacing = 16;
+    auto          claim      = [&](int i, int offset) {
+        auto& probe = probes[i & 4095];
+        auto  x     = probe.first.x + LandSpacing / 2;
+        return IntPos{BlockPos{x + offset, probe.first.y + offset, probe.first.z + offset}, probe.second};
+    };
+    auto expand = [](IntPos pos, int delta) {
+        return IntPos{BlockPos{pos.first.x + delta, pos.first.y + delta, pos.first.z + delta}, pos.second};
+    };
+    ns = measure([&](int i) {
+        auto lo = claim(i, -20), hi = claim(i, 19);
+        for (auto id : getLandAt2(expand(lo, -MinSpacing), expand(hi, MinSpacing))) {
+            auto aabb = getAABB(id);
+            gSink     = gSink + isComplis(lo, hi, aabb[0], aabb[1], MinSpacing, true);
+        }
+    });
+    row("getLandAt2 + isComplisWithMinSpacing", ns, 1);
+
+    ns = measure([&](int i) {
+        auto conflicts = findConflicts(claim(i, -20), claim(i, 19), MinSpacing, true, {});
+        gSink          = gSink + static_cast<int64_t>(conflicts.size());
+    });
+    row("LandRegistry_findConflicts", ns, 1);
+
+    // 删除 ID 最小的领地再以新 ID 重新创建 (有序列表的最坏情况)，放在最后以免影响上面的 ID
+    ns = measure([&](int) {
+        recreateFirstLand(getLands().front());
+        items = getLands().size();
+    });
+    row("recreate land + getLands()", ns, items);
+}
+
+} // namespace ldapi::bench
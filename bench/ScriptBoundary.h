@@ -0,0 +1,102 @@
+#pragma once
+#include "SyntheticLands.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+
+// 脚本 <-> 原生边界的开销模型
+// LegacyRemoteCall 每次调用都把参数与返回值打包为 ValueType (数字 / 字符串 / 坐标 / 数组 ...) 再解包，
+// 数组逐元素打包；这里以同样的结构往返一次。脚本引擎自身的调用与值转换不计入，因此是真实往返开销的下限
+
+namespace ldapi::bench {
+
+struct ScriptValue;
+using ScriptArray = std::vector<ScriptValue>;
+
+struct ScriptNumber {
+    int64_t i;
+    double  f;
+};
+
+struct ScriptBlockPos {
+    BlockPos pos;
+    int      dimid;
+};
+
+struct ScriptValue {
+    std::variant<std::monostate, bool, ScriptNumber, std::string, ScriptBlockPos, ScriptArray> data;
+};
+
+template <typename T>
+ScriptValue toScript(T const& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return {value};
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        return {ScriptNumber{static_cast<int64_t>(value), static_cast<double>(value)}};
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return {value};
+    } else if constexpr (std::is_same_v<T, IntPos>) {
+        return {ScriptBlockPos{value.first, value.second}};
+    } else {
+        ScriptArray array;
+        array.reserve(value.size());
+        for (auto const& item : value) {
+            array.push_back(toScript(item));
+        }
+        return {std::move(array)};
+    }
+}
+
+template <typename T>
+T fromScript(ScriptValue const& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return std::get<bool>(value.data);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<T>(std::get<ScriptNumber>(value.data).i);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return std::get<std::string>(value.data);
+    } else if constexpr (std::is_same_v<T, IntPos>) {
+        auto& pos = std::get<ScriptBlockPos>(value.data);
+        return {pos.pos, pos.dimid};
+    } else {
+        auto& array = std::get<ScriptArray>(value.data);
+        T     result;
+        result.reserve(array.size());
+        for (auto const& item : array) {
+            result.push_back(fromScript<typename T::value_type>(item));
+        }
+        return result;
+    }
+}
+
+template <typename Sig>
+struct ScriptImport;
+
+template <typename Ret, typename... Args>
+struct ScriptImport<Ret(Args...)> {
+    static std::function<Ret(Args...)> make(std::string const& sym) {
+        return [fn = importExport<Ret(Args...)>(sym)](Args... args) -> Ret {
+            ScriptArray packed{toScript(std::decay_t<Args>(args))...};
+            return fromScript<Ret>(toScript(call(fn, packed, std::index_sequence_for<Args...>{})));
+        };
+    }
+
+    template <size_t... I>
+    static Ret call(std::function<Ret(Args...)> const& fn, ScriptArray const& packed, std::index_sequence<I...>) {
+        return fn(fromScript<std::decay_t<Args>>(packed[I])...);
+    }
+};
+
+/// 以导出时的签名取回导出函数，每次调用都经过 ScriptValue 往返 (模拟脚本调用)
+template <typename Sig>
+std::function<Sig> importFromScript(std::string const& sym) {
+    return ScriptImport<Sig>::make(sym);
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,83 @@
+#include "SyntheticLands.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+extern void Export_Class_LandRegistry();
+extern void Export_Class_LandAABB();
+extern void Export_Class_Land();
+extern void Export_LDEvents();
+extern void Export_LandGeometry();
+extern void Export_Ffi();
+extern void Export_UUIDCache();
+extern void Export_CallMetrics();
+extern void Export_TraceRecorder();
+
+} // namespace ldapi
+
+
+namespace ldapi::bench {
+
+mce::UUID syntheticPlayer(size_t index) {
+    return {0x5EED000000000000ull | index, 0x4000000000000000ull | (index * 0x9E3779B97F4A7C15ull >> 2)};
+}
+
+BlockPos syntheticCenter(size_t index) {
+    auto x = static_cast<int>(index % GridColumns) * LandSpacing;
+    auto z = static_cast<int>(index / GridColumns) * LandSpacing;
+    return {x + 16, 64, z + 16};
+}
+
+// 70% 主世界，20% 下界，10% 末地
+int syntheticDimension(size_t index) {
+    auto bucket = index % 10;
+    return bucket < 7 ? 0 : bucket < 9 ? 1 : 2;
+}
+
+void growRegistry(size_t count) {
+    auto& registry = land::PLand::getInstance().getLandRegistry();
+    for (auto index = registry.size(); index < count; ++index) {
+        auto center = syntheticCenter(index);
+        auto is3D   = index % 10 == 3; // 10% 为 3D 领地
+        auto aabb   = land::LandAABB{
+            land::LandPos{center.x - 16, is3D ? 40 : -64, center.z - 16},
+            land::LandPos{center.x + 15, is3D ? 90 : 319, center.z + 15}
+        };
+        auto owner = syntheticPlayer(index % SyntheticPlayers);
+        auto land  = land::Land::make(aabb, syntheticDimension(index), is3D, owner);
+        land->setName("land_" + std::to_string(index));
+        land->addLandMember(syntheticPlayer((index * 7 + 1) % SyntheticPlayers));
+        land->addLandMember(syntheticPlayer((index * 13 + 2) % SyntheticPlayers));
+
+        auto table                     = land->getPermTable();
+        table.environment.allowExplode = index % 2 == 0;
+        table.role.allowDestroy.member = true;
+        table.role.allowPlace.member   = index % 3 != 0;
+        table.role.useDoor.actor       = index % 5 == 0;
+        land->setPermTable(table);
+
+        if (registry.addOrdinaryLand(land)) {
+            // 相当于 PLand 创建领地后发布的事件
+            LandObserver::getInstance().notify({land->getId(), LandChangeKind::Created});
+        }
+    }
+}
+
+void registerExports() {
+    Export_Class_LandRegistry();
+    Export_Class_LandAABB();
+    Export_Class_Land();
+    Export_LDEvents();
+    Export_LandGeometry();
+    Export_Ffi();
+    Export_UUIDCache();
+    Export_CallMetrics();
+    Export_TraceRecorder();
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,38 @@
+#pragma once
+#include "ExportDef.h"
+
+#include "mc/platform/UUID.h"
+#include "pland/land/Land.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+
+namespace ldapi::bench {
+
+constexpr size_t SyntheticPlayers = 100'000; // 领地主人 / 成员从这些玩家中轮流选取
+constexpr int    LandSpacing      = 48;      // 相邻领地的间距 (方块)，领地本身占 32x32
+constexpr int    GridColumns      = 1024;
+
+/// 第 index 个合成玩家
+mce::UUID syntheticPlayer(size_t index);
+
+/// 第 index 块合成领地的中心点 (维度见 syntheticDimension)
+BlockPos syntheticCenter(size_t index);
+
+int syntheticDimension(size_t index);
+
+/// 向注册表中追加合成领地，直到总数达到 count (可多次调用逐步扩大规模)
+void growRegistry(size_t count);
+
+/// 注册被测的导出函数 (与 MyMod::enable 相同，但不包含依赖服务器服务的部分)
+void registerExports();
+
+/// 以导出时的签名取回导出函数
+template <typename Sig>
+std::function<Sig> importExport(std::string const& sym) {
+    return RemoteCall::importAs<Sig>(ExportNamespace, sym);
+}
+
+} // namespace ldapi::bench
@@ -0,0 +1,60 @@
+#pragma once
+#include <any>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "mc/deps/core/math/Vec3.h"
+#include "mc/world/level/BlockPos.h"
+
+class Player;
+
+
+/**
+ * 宿主机版 LegacyRemoteCall: 导出函数按 "命名空间::函数名" 保存为 std::function
+ * importAs 需要与导出时完全相同的签名，不做脚本值转换 (基准只统计原生侧开销)
+ */
+namespace RemoteCall {
+
+namespace detail {
+
+inline std::unordered_map<std::string, std::any>& table() {
+    static std::unordered_map<std::string, std::any> instance;
+    return instance;
+}
+
+inline std::string key(std::string const& ns, std::string const& name) { return ns + "::" + name; }
+
+} // namespace detail
+
+template <typename Ret, typename... Args>
+bool exportAs(std::string const& ns, std::string const& name, std::function<Ret(Args...)> callback) {
+    return detail::table().insert_or_assign(detail::key(ns, name), std::move(callback)).second;
+}
+
+template <typename CB>
+bool exportAs(std::string const& ns, std::string const& name, CB&& callback) {
+    return exportAs(ns, name, std::function{std::forward<CB>(callback)});
+}
+
+inline bool hasFunc(std::string const& ns, std::string const& name) {
+    return detail::table().contains(detail::key(ns, name));
+}
+
+inline bool removeFunc(std::string const& ns, std::string const& name) {
+    return detail::table().erase(detail::key(ns, name)) > 0;
+}
+
+template <typename Sig>
+std::function<Sig> importAs(std::string const& ns, std::string const& name) {
+    auto iter = detail::table().find(detail::key(ns, name));
+    if (iter == detail::table().end()) {
+        throw std::runtime_error("RemoteCall: function not found: " + detail::key(ns, name));
+    }
+    return std::any_cast<std::function<Sig>>(iter->second);
+}
+
+} // namespace RemoteCall
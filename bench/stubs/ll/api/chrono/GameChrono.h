@@ -0,0 +1,10 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+
+namespace ll::chrono {
+
+using ticks = std::chrono::duration<int64_t, std::ratio<1, 20>>;
+
+} // namespace ll::chrono
@@ -0,0 +1,81 @@
+#pragma once
+#include <coroutine>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ll/api/chrono/GameChrono.h"
+
+
+namespace ll::coro {
+
+/**
+ * 宿主机上的 "服务器 tick": co_await ll::chrono::ticks{n} 挂起的协程在 n 次 tick() 后恢复
+ * 基准代码手动调用 tick() 驱动延迟投递 / 批量投递
+ */
+class TickScheduler {
+public:
+    void schedule(std::coroutine_handle<> handle, int64_t ticks) { mWaiting.push_back({handle, ticks}); }
+
+    void tick() {
+        auto waiting = std::move(mWaiting);
+        mWaiting.clear();
+        for (auto& [handle, remaining] : waiting) {
+            if (--remaining <= 0) {
+                handle.resume();
+            } else {
+                mWaiting.push_back({handle, remaining});
+            }
+        }
+    }
+
+    static TickScheduler& getInstance() {
+        static TickScheduler instance;
+        return instance;
+    }
+
+private:
+    struct Waiting {
+        std::coroutine_handle<> handle;
+        int64_t                 remaining;
+    };
+    std::vector<Waiting> mWaiting;
+};
+
+struct TickAwaiter {
+    int64_t ticks;
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) const { TickScheduler::getInstance().schedule(handle, ticks); }
+    void await_resume() const noexcept {}
+};
+
+template <class T = void>
+struct CoroTask {
+    struct promise_type {
+        CoroTask            get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void                return_void() {}
+        void                unhandled_exception() {}
+        TickAwaiter         await_transform(ll::chrono::ticks ticks) { return {ticks.count()}; }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+
+    // 立即运行到第一个挂起点，之后由 TickScheduler 恢复
+    template <class Executor>
+    void launch(Executor const&) {
+        handle.resume();
+    }
+};
+
+// 协程 lambda 的捕获需要与协程同寿命，这里直接把 lambda 放到堆上 (协程均为常驻循环)
+template <class F>
+auto keepThis(F&& fn) {
+    auto* kept = new std::decay_t<F>(std::forward<F>(fn));
+    return (*kept)();
+}
+
+} // namespace ll::coro
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "ll/api/event/ListenerBase.h"
+
+
+namespace ll::event {
+
+/**
+ * 同步事件总线: 按事件类型保存监听器，publish 时依次调用
+ * 基准代码通过 publish 模拟 PLand 触发事件
+ */
+class EventBus {
+public:
+    template <class E, class F>
+    ListenerPtr emplaceListener(F&& fn) {
+        auto listener = std::make_shared<Listener<E>>(std::forward<F>(fn));
+        mListeners[typeid(E)].push_back(listener);
+        return listener;
+    }
+
+    bool removeListener(ListenerPtr const& listener) {
+        for (auto& [type, listeners] : mListeners) {
+            if (std::erase(listeners, listener) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <class E>
+    void publish(E& ev) {
+        auto iter = mListeners.find(typeid(E));
+        if (iter == mListeners.end()) {
+            return;
+        }
+        // 回调中可能增删监听器，按下标遍历且持有当前监听器 (不复制列表，发布路径不分配内存)
+        auto& listeners = iter->second;
+        for (size_t i = 0; i < listeners.size(); ++i) {
+            auto listener = listeners[i];
+            static_cast<Listener<E>&>(*listener).callback(ev);
+        }
+    }
+
+    static EventBus& getInstance() {
+        static EventBus instance;
+        return instance;
+    }
+
+private:
+    template <class E>
+    struct Listener : ListenerBase {
+        explicit Listener(std::function<void(E&)> callback) : callback(std::move(callback)) {}
+        std::function<void(E&)> callback;
+    };
+
+    std::unordered_map<std::type_index, std::vector<ListenerPtr>> mListeners;
+};
+
+} // namespace ll::event
@@ -0,0 +1,14 @@
+#pragma once
+#include <memory>
+
+
+namespace ll::event {
+
+class ListenerBase {
+public:
+    virtual ~ListenerBase() = default;
+};
+
+using ListenerPtr = std::shared_ptr<ListenerBase>;
+
+} // namespace ll::event
@@ -0,0 +1,21 @@
+#pragma once
+#include <filesystem>
+#include <string>
+
+
+namespace ll::mod {
+
+class Mod {
+public:
+    [[nodiscard]] bool isEnabled() const { return true; }
+
+    [[nodiscard]] std::string const& getName() const { return mName; }
+
+    [[nodiscard]] std::filesystem::path const& getDataDir() const { return mDataDir; }
+
+private:
+    std::string           mName{"bench"};
+    std::filesystem::path mDataDir{"."};
+};
+
+} // namespace ll::mod
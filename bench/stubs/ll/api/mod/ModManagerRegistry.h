@@ -0,0 +1,24 @@
+#pragma once
+#include <memory>
+#include <string_view>
+
+#include "ll/api/mod/Mod.h"
+
+
+namespace ll::mod {
+
+// 所有脚本插件都视为已加载
+class ModManagerRegistry {
+public:
+    [[nodiscard]] std::shared_ptr<Mod> getMod(std::string_view) const { return mMod; }
+
+    static ModManagerRegistry& getInstance() {
+        static ModManagerRegistry instance;
+        return instance;
+    }
+
+private:
+    std::shared_ptr<Mod> mMod = std::make_shared<Mod>();
+};
+
+} // namespace ll::mod
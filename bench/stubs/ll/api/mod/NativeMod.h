@@ -0,0 +1,15 @@
+#pragma once
+#include "ll/api/mod/Mod.h"
+
+
+namespace ll::mod {
+
+class NativeMod : public Mod {
+public:
+    static NativeMod* current() {
+        static NativeMod instance;
+        return &instance;
+    }
+};
+
+} // namespace ll::mod
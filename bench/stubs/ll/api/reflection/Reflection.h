@@ -0,0 +1,24 @@
+#pragma once
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * 宿主机版成员反射: 结构体以 static constexpr reflection() 返回成员元组 (名称, 成员指针)
+ * LeviLamina 的实现基于聚合体反射，不需要这个声明
+ */
+#define LDAPI_REFLECT_FIELD(Type, field) std::pair<std::string_view, decltype(&Type::field)>{#field, &Type::field}
+
+namespace ll::reflection {
+
+template <class T, class F>
+void forEachMember(T& obj, F&& fn) {
+    std::apply(
+        [&](auto const&... field) { (fn(field.first, obj.*(field.second)), ...); },
+        std::remove_const_t<T>::reflection()
+    );
+}
+
+} // namespace ll::reflection
@@ -0,0 +1,12 @@
+#pragma once
+#include "mc/world/level/Level.h"
+
+
+namespace ll::service {
+
+inline Level* getLevel() {
+    static Level level;
+    return &level;
+}
+
+} // namespace ll::service
@@ -0,0 +1,13 @@
+#pragma once
+
+
+namespace ll::thread {
+
+struct ServerThreadExecutor {
+    static ServerThreadExecutor const& getDefault() {
+        static ServerThreadExecutor instance;
+        return instance;
+    }
+};
+
+} // namespace ll::thread
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+
+using int64  = long long;
+using uint64 = unsigned long long;
+using uint   = unsigned int;
+
+namespace ll::hash_utils {
+
+constexpr uint64_t doHash(std::string_view str) {
+    uint64_t hash = 14695981039346656037ull; // FNV-1a
+    for (char c : str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace ll::hash_utils
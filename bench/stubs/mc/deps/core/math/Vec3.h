@@ -0,0 +1,7 @@
+#pragma once
+
+
+class Vec3 {
+public:
+    float x{}, y{}, z{};
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "fmt/format.h"
+
+
+namespace mce {
+
+// 与 BDS 一致: 128 位，字符串形式为 8-4-4-4-12 的小写十六进制
+class UUID {
+public:
+    uint64_t a{}, b{};
+
+    UUID() = default;
+    UUID(uint64_t a, uint64_t b) : a(a), b(b) {}
+    explicit UUID(std::string const& str) : UUID(fromString(str)) {}
+
+    static bool canParse(std::string const& str) {
+        if (str.size() != 36) {
+            return false;
+        }
+        for (size_t i = 0; i < str.size(); ++i) {
+            bool dash = i == 8 || i == 13 || i == 18 || i == 23;
+            if (dash ? str[i] != '-' : !std::isxdigit(static_cast<unsigned char>(str[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static UUID fromString(std::string const& str) {
+        if (!canParse(str)) {
+            return {};
+        }
+        uint64_t parts[2]{};
+        int      nibble = 0;
+        for (char c : str) {
+            if (c == '-') {
+                continue;
+            }
+            auto  value = static_cast<uint64_t>(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+            auto& part  = parts[nibble / 16];
+            part        = (part << 4) | value;
+            ++nibble;
+        }
+        return {parts[0], parts[1]};
+    }
+
+    [[nodiscard]] std::string asString() const {
+        return fmt::format(
+            "{:08x}-{:04x}-{:04x}-{:04x}-{:012x}",
+            a >> 32,
+            (a >> 16) & 0xFFFF,
+            a & 0xFFFF,
+            b >> 48,
+            b & 0xFFFFFFFFFFFF
+        );
+    }
+
+    bool operator==(UUID const&) const = default;
+
+    static const UUID EMPTY;
+};
+
+inline const UUID UUID::EMPTY{};
+
+} // namespace mce
+
+template <>
+struct std::hash<mce::UUID> {
+    size_t operator()(mce::UUID const& uuid) const noexcept { return uuid.a ^ (uuid.b * 0x9E3779B97F4A7C15ull); }
+};
@@ -0,0 +1,12 @@
+#pragma once
+#include "mc/platform/UUID.h"
+
+
+class Player {
+public:
+    mce::UUID uuid;
+    int       dimensionId{0};
+
+    [[nodiscard]] mce::UUID getUuid() const { return uuid; }
+    [[nodiscard]] int       getDimensionId() const { return dimensionId; }
+};
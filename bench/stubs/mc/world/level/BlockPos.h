@@ -0,0 +1,12 @@
+#pragma once
+
+
+class BlockPos {
+public:
+    int x{}, y{}, z{};
+
+    BlockPos() = default;
+    BlockPos(int x, int y, int z) : x(x), y(y), z(z) {}
+
+    bool operator==(BlockPos const&) const = default;
+};
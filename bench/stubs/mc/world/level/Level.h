@@ -0,0 +1,16 @@
+#pragma once
+#include <unordered_map>
+
+#include "mc/platform/UUID.h"
+#include "mc/world/actor/player/Player.h"
+
+
+class Level {
+public:
+    std::unordered_map<mce::UUID, Player*> players; // 由基准代码填充
+
+    [[nodiscard]] Player* getPlayer(mce::UUID const& uuid) const {
+        auto iter = players.find(uuid);
+        return iter == players.end() ? nullptr : iter->second;
+    }
+};
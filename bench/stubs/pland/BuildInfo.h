@@ -0,0 +1,11 @@
+#pragma once
+#include <string_view>
+
+
+namespace land::BuildInfo {
+
+constexpr std::string_view Commit = "bench";
+constexpr std::string_view Branch = "bench";
+constexpr std::string_view Tag    = "bench";
+
+} // namespace land::BuildInfo
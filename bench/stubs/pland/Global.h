@@ -0,0 +1,85 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "fmt/core.h"
+#include "nlohmann/json.hpp"
+
+#include "ll/api/utils/HashUtils.h"
+#include "mc/platform/UUID.h"
+#include "mc/world/level/BlockPos.h"
+
+
+namespace ll {
+
+class Error {
+public:
+    Error() = default;
+    explicit Error(std::string message) : mMessage(std::move(message)) {}
+
+    [[nodiscard]] std::string const& message() const { return mMessage; }
+
+private:
+    std::string mMessage;
+};
+
+// ll::Expected 的最小替身 (只实现导出层用到的接口)
+template <class T = void>
+class Expected {
+public:
+    using value_type = T;
+
+    Expected(T value) : mValue(std::move(value)) {}  // NOLINT(google-explicit-constructor)
+    Expected(Error error) : mError(std::move(error)) {} // NOLINT(google-explicit-constructor)
+
+    explicit operator bool() const { return mValue.has_value(); }
+
+    [[nodiscard]] T const&     value() const { return *mValue; }
+    [[nodiscard]] Error const& error() const { return mError; }
+
+private:
+    std::optional<T> mValue;
+    Error            mError;
+};
+
+template <>
+class Expected<void> {
+public:
+    using value_type = void;
+
+    Expected() = default;
+    Expected(Error error) : mOk(false), mError(std::move(error)) {} // NOLINT(google-explicit-constructor)
+
+    explicit operator bool() const { return mOk; }
+
+    void                       value() const {}
+    [[nodiscard]] Error const& error() const { return mError; }
+
+private:
+    bool  mOk{true};
+    Error mError;
+};
+
+inline Error makeStringError(std::string message) { return Error{std::move(message)}; }
+
+} // namespace ll
+
+
+namespace land {
+
+using LandID    = int64_t;
+using LandDimid = int;
+using ChunkID   = uint64_t;
+
+constexpr LandID INVALID_LAND_ID = -1;
+
+enum class LandPermType { Admin = 0, Owner = 1, Member = 2, Actor = 3 };
+
+class Land;
+using SharedLand = std::shared_ptr<Land>;
+using WeakLand   = std::weak_ptr<Land>;
+
+} // namespace land
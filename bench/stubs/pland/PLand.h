@@ -0,0 +1,20 @@
+#pragma once
+#include "pland/land/repo/LandRegistry.h"
+
+
+namespace land {
+
+class PLand {
+public:
+    LandRegistry& getLandRegistry() { return mRegistry; }
+
+    static PLand& getInstance() {
+        static PLand instance;
+        return instance;
+    }
+
+private:
+    LandRegistry mRegistry;
+};
+
+} // namespace land
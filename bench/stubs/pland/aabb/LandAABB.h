@@ -0,0 +1,138 @@
+#pragma once
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mc/deps/core/math/Vec3.h"
+#include "pland/aabb/LandPos.h"
+
+
+// 与 PLand 的 LandAABB 语义一致 (闭区间，getRange 按 x -> z -> y 顺序)，用于在宿主机上复现生成开销
+namespace land {
+
+class LandAABB {
+public:
+    LandPos min, max;
+
+    static LandAABB make(LandPos const& a, LandPos const& b) { return {a, b}; }
+
+    void fix() {
+        if (min.x > max.x) std::swap(min.x, max.x);
+        if (min.y > max.y) std::swap(min.y, max.y);
+        if (min.z > max.z) std::swap(min.z, max.z);
+    }
+
+    [[nodiscard]] LandPos const& getMin() const { return min; }
+    [[nodiscard]] LandPos const& getMax() const { return max; }
+
+    [[nodiscard]] int       getSpanX() const { return max.x - min.x + 1; }
+    [[nodiscard]] int       getSpanY() const { return max.y - min.y + 1; }
+    [[nodiscard]] int       getSpanZ() const { return max.z - min.z + 1; }
+    [[nodiscard]] long long getSquare() const { return static_cast<long long>(getSpanX()) * getSpanZ(); }
+    [[nodiscard]] long long getVolume() const { return getSquare() * getSpanY(); }
+
+    [[nodiscard]] std::string toString() const {
+        return fmt::format("({},{},{}) => ({},{},{})", min.x, min.y, min.z, max.x, max.y, max.z);
+    }
+
+    [[nodiscard]] std::vector<BlockPos> getRange() const {
+        std::vector<BlockPos> result;
+        result.reserve(static_cast<size_t>(getVolume()));
+        for (int x = min.x; x <= max.x; ++x) {
+            for (int z = min.z; z <= max.z; ++z) {
+                for (int y = min.y; y <= max.y; ++y) {
+                    result.emplace_back(x, y, z);
+                }
+            }
+        }
+        return result;
+    }
+
+    // 12 条棱上的所有方块 (棱的端点会重复出现)
+    [[nodiscard]] std::vector<BlockPos> getBorder() const {
+        std::vector<BlockPos> result;
+        for (int x = min.x; x <= max.x; ++x) {
+            result.emplace_back(x, min.y, min.z);
+            result.emplace_back(x, min.y, max.z);
+            result.emplace_back(x, max.y, min.z);
+            result.emplace_back(x, max.y, max.z);
+        }
+        for (int y = min.y; y <= max.y; ++y) {
+            result.emplace_back(min.x, y, min.z);
+            result.emplace_back(min.x, y, max.z);
+            result.emplace_back(max.x, y, min.z);
+            result.emplace_back(max.x, y, max.z);
+        }
+        for (int z = min.z; z <= max.z; ++z) {
+            result.emplace_back(min.x, min.y, z);
+            result.emplace_back(min.x, max.y, z);
+            result.emplace_back(max.x, min.y, z);
+            result.emplace_back(max.x, max.y, z);
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<Vec3> getVertices() const {
+        std::vector<Vec3> result;
+        for (auto x : {min.x, max.x}) {
+            for (auto y : {min.y, max.y}) {
+                for (auto z : {min.z, max.z}) {
+                    result.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)});
+                }
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<Vec3> getCorners() const {
+        auto y = static_cast<float>(min.y);
+        return {
+            {static_cast<float>(min.x), y, static_cast<float>(min.z)},
+            {static_cast<float>(max.x), y, static_cast<float>(min.z)},
+            {static_cast<float>(max.x), y, static_cast<float>(max.z)},
+            {static_cast<float>(min.x), y, static_cast<float>(max.z)},
+        };
+    }
+
+    [[nodiscard]] std::vector<std::pair<BlockPos, BlockPos>> getEdges() const {
+        std::vector<std::pair<BlockPos, BlockPos>> result;
+        for (auto y : {min.y, max.y}) {
+            for (auto z : {min.z, max.z}) result.emplace_back(BlockPos{min.x, y, z}, BlockPos{max.x, y, z});
+        }
+        for (auto x : {min.x, max.x}) {
+            for (auto z : {min.z, max.z}) result.emplace_back(BlockPos{x, min.y, z}, BlockPos{x, max.y, z});
+        }
+        for (auto x : {min.x, max.x}) {
+            for (auto y : {min.y, max.y}) result.emplace_back(BlockPos{x, y, min.z}, BlockPos{x, y, max.z});
+        }
+        return result;
+    }
+
+    [[nodiscard]] bool hasPos(BlockPos const& pos, bool includeY = true) const {
+        return pos.x >= min.x && pos.x <= max.x && pos.z >= min.z && pos.z <= max.z
+            && (!includeY || (pos.y >= min.y && pos.y <= max.y));
+    }
+
+    static bool isCollision(LandAABB const& a, LandAABB const& b) {
+        return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y
+            && a.min.z <= b.max.z && a.max.z >= b.min.z;
+    }
+
+    static bool isComplisWithMinSpacing(LandAABB const& a, LandAABB const& b, int minSpacing, bool includeY = true) {
+        auto gap = [](int aMin, int aMax, int bMin, int bMax) { return std::max(bMin - aMax, aMin - bMax) - 1; };
+        auto dx  = gap(a.min.x, a.max.x, b.min.x, b.max.x);
+        auto dz  = gap(a.min.z, a.max.z, b.min.z, b.max.z);
+        auto dy  = gap(a.min.y, a.max.y, b.min.y, b.max.y);
+        return dx >= minSpacing || dz >= minSpacing || (includeY && dy >= minSpacing);
+    }
+
+    static bool isContain(LandAABB const& a, LandAABB const& b) {
+        return a.min.x <= b.min.x && a.min.y <= b.min.y && a.min.z <= b.min.z && a.max.x >= b.max.x
+            && a.max.y >= b.max.y && a.max.z >= b.max.z;
+    }
+
+    bool operator==(LandAABB const&) const = default;
+};
+
+} // namespace land
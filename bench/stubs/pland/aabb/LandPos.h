@@ -0,0 +1,22 @@
+#pragma once
+#include "pland/Global.h"
+
+
+namespace land {
+
+class LandPos {
+public:
+    int x{}, y{}, z{};
+
+    static LandPos make(BlockPos const& pos) { return {pos.x, pos.y, pos.z}; }
+    static LandPos make(int x, int y, int z) { return {x, y, z}; }
+
+    template <class T = BlockPos>
+    [[nodiscard]] T as() const {
+        return T{x, y, z};
+    }
+
+    bool operator==(LandPos const&) const = default;
+};
+
+} // namespace land
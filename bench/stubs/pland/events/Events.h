@@ -0,0 +1,174 @@
+#pragma once
+#include <utility>
+
+#include "mc/world/actor/player/Player.h"
+#include "pland/land/Land.h"
+#include "pland/land/LandResizeSettlement.h"
+
+
+/**
+ * 宿主机版 PLand 事件: 访问器与 PLand 一致，数据通过公开成员构造
+ * Before 类事件 (及 PlayerRequestCreateLandEvent) 可拦截
+ */
+namespace land::event {
+
+struct Cancellable {
+    bool cancelled{false};
+
+    void cancel() { cancelled = true; }
+};
+
+struct LandEvent {
+    SharedLand mLand;
+
+    [[nodiscard]] SharedLand land() const { return mLand; }
+};
+
+struct PlayerLandEvent : LandEvent {
+    Player* mPlayer{nullptr};
+
+    [[nodiscard]] Player& self() const { return *mPlayer; }
+};
+
+// domain
+struct LandResizedEvent : LandEvent {
+    LandAABB mNewRange;
+
+    [[nodiscard]] LandAABB const& newRange() const { return mNewRange; }
+};
+struct MemberChangedEvent : LandEvent {
+    mce::UUID mTarget;
+    bool      mIsAdd{true};
+
+    [[nodiscard]] mce::UUID target() const { return mTarget; }
+    [[nodiscard]] bool      isAdd() const { return mIsAdd; }
+};
+struct OwnerChangedEvent : LandEvent {
+    mce::UUID mOldOwner, mNewOwner;
+
+    [[nodiscard]] mce::UUID oldOwner() const { return mOldOwner; }
+    [[nodiscard]] mce::UUID newOwner() const { return mNewOwner; }
+};
+struct LandRecycleEvent : LandEvent {
+    int mReason{0};
+
+    [[nodiscard]] int reason() const { return mReason; }
+};
+struct LandStateChangedEvent : LandEvent {
+    LeaseState mOldState{}, mNewState{};
+
+    [[nodiscard]] LeaseState oldState() const { return mOldState; }
+    [[nodiscard]] LeaseState newState() const { return mNewState; }
+};
+struct MembersClearedEvent : LandEvent {};
+
+// economy
+struct LandRefundFailedEvent : LandEvent {
+    mce::UUID mTarget;
+    int       mAmount{0};
+
+    [[nodiscard]] mce::UUID targetPlayer() const { return mTarget; }
+    [[nodiscard]] int       refundAmount() const { return mAmount; }
+};
+
+// player
+struct PlayerApplyLandRangeChangeBeforeEvent : PlayerLandEvent, Cancellable {
+    LandAABB             mNewRange;
+    LandResizeSettlement mSettlement;
+
+    [[nodiscard]] LandAABB const&             newRange() const { return mNewRange; }
+    [[nodiscard]] LandResizeSettlement const& resizeSettlement() const { return mSettlement; }
+};
+struct PlayerApplyLandRangeChangeAfterEvent : PlayerLandEvent {
+    LandAABB             mNewRange;
+    LandResizeSettlement mSettlement;
+
+    [[nodiscard]] LandAABB const&             newRange() const { return mNewRange; }
+    [[nodiscard]] LandResizeSettlement const& resizeSettlement() const { return mSettlement; }
+};
+
+struct PlayerBuyLandBeforeEvent : Cancellable {
+    Player*  mPlayer{nullptr};
+    int      mPayMoney{0};
+    LandType mLandType{};
+
+    [[nodiscard]] Player&  self() const { return *mPlayer; }
+    [[nodiscard]] int      payMoney() const { return mPayMoney; }
+    [[nodiscard]] LandType landType() const { return mLandType; }
+};
+struct PlayerBuyLandAfterEvent : PlayerLandEvent {
+    int mPayMoney{0};
+
+    [[nodiscard]] int payMoney() const { return mPayMoney; }
+};
+
+struct PlayerChangeLandMemberBeforeEvent : PlayerLandEvent, Cancellable {
+    mce::UUID mTarget;
+    bool      mIsAdd{true};
+
+    [[nodiscard]] mce::UUID target() const { return mTarget; }
+    [[nodiscard]] bool      isAdd() const { return mIsAdd; }
+};
+struct PlayerChangeLandMemberAfterEvent : PlayerLandEvent {
+    mce::UUID mTarget;
+    bool      mIsAdd{true};
+
+    [[nodiscard]] mce::UUID target() const { return mTarget; }
+    [[nodiscard]] bool      isAdd() const { return mIsAdd; }
+};
+
+struct PlayerChangeLandNameBeforeEvent : PlayerLandEvent, Cancellable {
+    std::string mNewName;
+
+    [[nodiscard]] std::string const& newName() const { return mNewName; }
+};
+struct PlayerChangeLandNameAfterEvent : PlayerLandEvent {
+    std::string mNewName;
+
+    [[nodiscard]] std::string const& newName() const { return mNewName; }
+};
+
+struct PlayerDeleteLandBeforeEvent : PlayerLandEvent, Cancellable {};
+struct PlayerDeleteLandAfterEvent : PlayerLandEvent {};
+
+struct PlayerEnterLandEvent {
+    Player* mPlayer{nullptr};
+    LandID  mLandId{INVALID_LAND_ID};
+
+    [[nodiscard]] Player& self() const { return *mPlayer; }
+    [[nodiscard]] LandID  landId() const { return mLandId; }
+};
+struct PlayerLeaveLandEvent : PlayerEnterLandEvent {};
+
+struct PlayerLeaseLandEvent : LandEvent {
+    int mPayMoney{0};
+    int mDays{0};
+
+    [[nodiscard]] int payMoney() const { return mPayMoney; }
+    [[nodiscard]] int days() const { return mDays; }
+};
+struct PlayerRenewLandEvent : PlayerLeaseLandEvent {};
+
+struct PlayerRequestChangeLandRangeBeforeEvent : PlayerLandEvent, Cancellable {};
+struct PlayerRequestChangeLandRangeAfterEvent : PlayerLandEvent {};
+
+struct PlayerRequestCreateLandEvent : Cancellable {
+    Player*  mPlayer{nullptr};
+    LandType mType{};
+
+    [[nodiscard]] Player&  self() const { return *mPlayer; }
+    [[nodiscard]] LandType type() const { return mType; }
+};
+
+struct PlayerTransferLandBeforeEvent : PlayerLandEvent, Cancellable {
+    mce::UUID mNewOwner;
+
+    [[nodiscard]] mce::UUID newOwner() const { return mNewOwner; }
+};
+struct PlayerTransferLandAfterEvent : PlayerLandEvent {
+    mce::UUID mNewOwner;
+
+    [[nodiscard]] mce::UUID newOwner() const { return mNewOwner; }
+};
+
+} // namespace land::event
@@ -0,0 +1,130 @@
+#pragma once
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "pland/aabb/LandAABB.h"
+#include "pland/land/LandPermTable.h"
+
+
+namespace land {
+
+enum class LandType { Ordinary, Parent, Mix, Sub };
+enum class LandHoldType { Bought, Leased };
+enum class LeaseState { None, Active, Frozen, Expired };
+
+/**
+ * 宿主机版领地: 只保存导出层读取的字段，ID 由 LandRegistry::addOrdinaryLand 分配
+ */
+class Land {
+public:
+    static SharedLand make(LandAABB const& aabb, LandDimid dimid, bool is3D, mce::UUID const& owner) {
+        auto land          = std::make_shared<Land>();
+        land->mAABB        = aabb;
+        land->mDimid       = dimid;
+        land->mIs3D        = is3D;
+        land->mOwner       = owner;
+        land->mTeleportPos = aabb.min;
+        return land;
+    }
+
+    [[nodiscard]] LandID    getId() const { return mId; }
+    [[nodiscard]] LandDimid getDimensionId() const { return mDimid; }
+
+    [[nodiscard]] LandAABB const& getAABB() const { return mAABB; }
+    void                          setAABB(LandAABB const& aabb) { mAABB = aabb; }
+    [[nodiscard]] LandPos const&  getTeleportPos() const { return mTeleportPos; }
+    void                          setTeleportPos(LandPos const& pos) { mTeleportPos = pos; }
+
+    [[nodiscard]] LandPermTable const& getPermTable() const { return mPermTable; }
+    void                               setPermTable(LandPermTable table) { mPermTable = table; }
+
+    [[nodiscard]] mce::UUID const&   getOwner() const { return mOwner; }
+    void                             setOwner(mce::UUID const& owner) { mOwner = owner; }
+    [[nodiscard]] std::string const& getRawOwner() const { return mRawOwner; }
+
+    [[nodiscard]] std::vector<mce::UUID> const& getMembers() const { return mMembers; }
+
+    bool addLandMember(mce::UUID const& uuid) {
+        if (isMember(uuid)) {
+            return false;
+        }
+        mMembers.push_back(uuid);
+        return true;
+    }
+    bool removeLandMember(mce::UUID const& uuid) { return std::erase(mMembers, uuid) > 0; }
+
+    [[nodiscard]] std::string const& getName() const { return mName; }
+    void                             setName(std::string const& name) { mName = name; }
+
+    [[nodiscard]] int getOriginalBuyPrice() const { return mOriginalBuyPrice; }
+    void              setOriginalBuyPrice(int price) { mOriginalBuyPrice = price; }
+
+    [[nodiscard]] bool is3D() const { return mIs3D; }
+    [[nodiscard]] bool isOwner(mce::UUID const& uuid) const { return mOwner == uuid; }
+    [[nodiscard]] bool isMember(mce::UUID const& uuid) const {
+        return std::find(mMembers.begin(), mMembers.end(), uuid) != mMembers.end();
+    }
+
+    [[nodiscard]] LandPermType getPermType(mce::UUID const& uuid) const {
+        if (isOwner(uuid)) return LandPermType::Owner;
+        if (isMember(uuid)) return LandPermType::Member;
+        return LandPermType::Actor;
+    }
+
+    [[nodiscard]] bool isCollision(BlockPos const& pos, int radius) const {
+        auto area = LandAABB{
+            LandPos{pos.x - radius, pos.y - radius, pos.z - radius},
+            LandPos{pos.x + radius, pos.y + radius, pos.z + radius}
+        };
+        return LandAABB::isCollision(mAABB, area);
+    }
+    [[nodiscard]] bool isCollision(BlockPos const& a, BlockPos const& b) const {
+        auto area = LandAABB::make(LandPos::make(a), LandPos::make(b));
+        area.fix();
+        return LandAABB::isCollision(mAABB, area);
+    }
+
+    // 以下字段与导出层的基准无关，返回固定值
+    [[nodiscard]] bool                isSystemOwned() const { return false; }
+    [[nodiscard]] bool                isBought() const { return true; }
+    [[nodiscard]] bool                isLeased() const { return false; }
+    [[nodiscard]] bool                isLeaseActive() const { return false; }
+    [[nodiscard]] bool                isLeaseFrozen() const { return false; }
+    [[nodiscard]] bool                isLeaseExpired() const { return false; }
+    [[nodiscard]] LandHoldType        getHoldType() const { return LandHoldType::Bought; }
+    [[nodiscard]] LeaseState          getLeaseState() const { return LeaseState::None; }
+    [[nodiscard]] long long           getLeaseStartAt() const { return 0; }
+    [[nodiscard]] long long           getLeaseEndAt() const { return 0; }
+    [[nodiscard]] bool                isConvertedLand() const { return false; }
+    [[nodiscard]] bool                isOwnerDataIsXUID() const { return false; }
+    [[nodiscard]] bool                isDirty() const { return false; }
+    [[nodiscard]] LandType            getType() const { return LandType::Ordinary; }
+    [[nodiscard]] bool                hasParentLand() const { return false; }
+    [[nodiscard]] bool                hasSubLand() const { return false; }
+    [[nodiscard]] bool                isSubLand() const { return false; }
+    [[nodiscard]] bool                isParentLand() const { return false; }
+    [[nodiscard]] bool                isMixLand() const { return false; }
+    [[nodiscard]] bool                isOrdinaryLand() const { return true; }
+    [[nodiscard]] bool                canCreateSubLand() const { return true; }
+    [[nodiscard]] LandID              getParentLandID() const { return INVALID_LAND_ID; }
+    [[nodiscard]] std::vector<LandID> getSubLandIDs() const { return {}; }
+    [[nodiscard]] int                 getNestedLevel() const { return 0; }
+
+private:
+    friend class LandRegistry;
+
+    LandID                 mId{INVALID_LAND_ID};
+    LandDimid              mDimid{0};
+    LandAABB               mAABB;
+    LandPos                mTeleportPos;
+    LandPermTable          mPermTable{};
+    mce::UUID              mOwner;
+    std::string            mRawOwner;
+    std::vector<mce::UUID> mMembers;
+    std::string            mName{"Unnamed"};
+    int                    mOriginalBuyPrice{0};
+    bool                   mIs3D{false};
+};
+
+} // namespace land
@@ -0,0 +1,181 @@
+#pragma once
+#include <tuple>
+
+#include "ll/api/reflection/Reflection.h"
+
+
+// 字段规模与 PLand v0.21 的权限表相当 (环境开关 + 按角色的交互开关)，用于衡量序列化开销
+namespace land {
+
+struct EnvironmentPerms {
+    bool allowFireSpread{false};
+    bool allowMonsterSpawn{false};
+    bool allowAnimalSpawn{false};
+    bool allowExplode{false};
+    bool allowFarmDecay{false};
+    bool allowPistonPushOnBoundary{false};
+    bool allowRedstoneUpdate{false};
+    bool allowBlockFall{false};
+    bool allowWitherDestroy{false};
+    bool allowLiquidFlow{false};
+    bool allowDragonEggTeleport{false};
+    bool allowSculkBlockGrowth{false};
+    bool allowMonsterGrief{false};
+    bool allowLightningStrike{false};
+
+    static constexpr auto reflection() {
+        return std::make_tuple(
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowFireSpread),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowMonsterSpawn),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowAnimalSpawn),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowExplode),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowFarmDecay),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowPistonPushOnBoundary),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowRedstoneUpdate),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowBlockFall),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowWitherDestroy),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowLiquidFlow),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowDragonEggTeleport),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowSculkBlockGrowth),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowMonsterGrief),
+            LDAPI_REFLECT_FIELD(EnvironmentPerms, allowLightningStrike)
+        );
+    }
+};
+
+struct RoleEntry {
+    bool member{false};
+    bool actor{false};
+
+    static constexpr auto reflection() {
+        return std::make_tuple(LDAPI_REFLECT_FIELD(RoleEntry, member), LDAPI_REFLECT_FIELD(RoleEntry, actor));
+    }
+};
+
+struct RolePerms {
+    RoleEntry allowDestroy{};
+    RoleEntry allowPlace{};
+    RoleEntry allowPlayerPickupItem{};
+    RoleEntry allowInteractEntity{};
+    RoleEntry allowAttackPlayer{};
+    RoleEntry allowAttackAnimal{};
+    RoleEntry allowAttackMonster{};
+    RoleEntry allowOpenChest{};
+    RoleEntry allowProjectileCreate{};
+    RoleEntry allowRideEntity{};
+    RoleEntry useBed{};
+    RoleEntry useBucket{};
+    RoleEntry useAxe{};
+    RoleEntry useHoe{};
+    RoleEntry useShovel{};
+    RoleEntry useAnvil{};
+    RoleEntry useBarrel{};
+    RoleEntry useBeacon{};
+    RoleEntry useBell{};
+    RoleEntry useBlastFurnace{};
+    RoleEntry useBrewingStand{};
+    RoleEntry useCampfire{};
+    RoleEntry useFlintAndSteel{};
+    RoleEntry useCartographyTable{};
+    RoleEntry useComposter{};
+    RoleEntry useCraftingTable{};
+    RoleEntry useDaylightDetector{};
+    RoleEntry useDispenser{};
+    RoleEntry useDropper{};
+    RoleEntry useEnchantingTable{};
+    RoleEntry useDoor{};
+    RoleEntry useFenceGate{};
+    RoleEntry useFurnace{};
+    RoleEntry useGrindstone{};
+    RoleEntry useHopper{};
+    RoleEntry useJukebox{};
+    RoleEntry useLoom{};
+    RoleEntry useStonecutter{};
+    RoleEntry useNoteBlock{};
+    RoleEntry useSmithingTable{};
+    RoleEntry useSmoker{};
+    RoleEntry useTrapdoor{};
+    RoleEntry useLectern{};
+    RoleEntry useCauldron{};
+    RoleEntry useLever{};
+    RoleEntry useButton{};
+    RoleEntry useRespawnAnchor{};
+    RoleEntry useItemFrame{};
+    RoleEntry usePressurePlate{};
+    RoleEntry useArmorStand{};
+    RoleEntry editSign{};
+    RoleEntry placeBoat{};
+    RoleEntry placeMinecart{};
+
+    static constexpr auto reflection() {
+        return std::make_tuple(
+            LDAPI_REFLECT_FIELD(RolePerms, allowDestroy),
+            LDAPI_REFLECT_FIELD(RolePerms, allowPlace),
+            LDAPI_REFLECT_FIELD(RolePerms, allowPlayerPickupItem),
+            LDAPI_REFLECT_FIELD(RolePerms, allowInteractEntity),
+            LDAPI_REFLECT_FIELD(RolePerms, allowAttackPlayer),
+            LDAPI_REFLECT_FIELD(RolePerms, allowAttackAnimal),
+            LDAPI_REFLECT_FIELD(RolePerms, allowAttackMonster),
+            LDAPI_REFLECT_FIELD(RolePerms, allowOpenChest),
+            LDAPI_REFLECT_FIELD(RolePerms, allowProjectileCreate),
+            LDAPI_REFLECT_FIELD(RolePerms, allowRideEntity),
+            LDAPI_REFLECT_FIELD(RolePerms, useBed),
+            LDAPI_REFLECT_FIELD(RolePerms, useBucket),
+            LDAPI_REFLECT_FIELD(RolePerms, useAxe),
+            LDAPI_REFLECT_FIELD(RolePerms, useHoe),
+            LDAPI_REFLECT_FIELD(RolePerms, useShovel),
+            LDAPI_REFLECT_FIELD(RolePerms, useAnvil),
+            LDAPI_REFLECT_FIELD(RolePerms, useBarrel),
+            LDAPI_REFLECT_FIELD(RolePerms, useBeacon),
+            LDAPI_REFLECT_FIELD(RolePerms, useBell),
+            LDAPI_REFLECT_FIELD(RolePerms, useBlastFurnace),
+            LDAPI_REFLECT_FIELD(RolePerms, useBrewingStand),
+            LDAPI_REFLECT_FIELD(RolePerms, useCampfire),
+            LDAPI_REFLECT_FIELD(RolePerms, useFlintAndSteel),
+            LDAPI_REFLECT_FIELD(RolePerms, useCartographyTable),
+            LDAPI_REFLECT_FIELD(RolePerms, useComposter),
+            LDAPI_REFLECT_FIELD(RolePerms, useCraftingTable),
+            LDAPI_REFLECT_FIELD(RolePerms, useDaylightDetector),
+            LDAPI_REFLECT_FIELD(RolePerms, useDispenser),
+            LDAPI_REFLECT_FIELD(RolePerms, useDropper),
+            LDAPI_REFLECT_FIELD(RolePerms, useEnchantingTable),
+            LDAPI_REFLECT_FIELD(RolePerms, useDoor),
+            LDAPI_REFLECT_FIELD(RolePerms, useFenceGate),
+            LDAPI_REFLECT_FIELD(RolePerms, useFurnace),
+            LDAPI_REFLECT_FIELD(RolePerms, useGrindstone),
+            LDAPI_REFLECT_FIELD(RolePerms, useHopper),
+            LDAPI_REFLECT_FIELD(RolePerms, useJukebox),
+            LDAPI_REFLECT_FIELD(RolePerms, useLoom),
+            LDAPI_REFLECT_FIELD(RolePerms, useStonecutter),
+            LDAPI_REFLECT_FIELD(RolePerms, useNoteBlock),
+            LDAPI_REFLECT_FIELD(RolePerms, useSmithingTable),
+            LDAPI_REFLECT_FIELD(RolePerms, useSmoker),
+            LDAPI_REFLECT_FIELD(RolePerms, useTrapdoor),
+            LDAPI_REFLECT_FIELD(RolePerms, useLectern),
+            LDAPI_REFLECT_FIELD(RolePerms, useCauldron),
+            LDAPI_REFLECT_FIELD(RolePerms, useLever),
+            LDAPI_REFLECT_FIELD(RolePerms, useButton),
+            LDAPI_REFLECT_FIELD(RolePerms, useRespawnAnchor),
+            LDAPI_REFLECT_FIELD(RolePerms, useItemFrame),
+            LDAPI_REFLECT_FIELD(RolePerms, usePressurePlate),
+            LDAPI_REFLECT_FIELD(RolePerms, useArmorStand),
+            LDAPI_REFLECT_FIELD(RolePerms, editSign),
+            LDAPI_REFLECT_FIELD(RolePerms, placeBoat),
+            LDAPI_REFLECT_FIELD(RolePerms, placeMinecart)
+        );
+    }
+};
+
+struct LandPermTable {
+    EnvironmentPerms environment{};
+    RolePerms        role{};
+
+    static constexpr auto reflection() {
+        return std::make_tuple(
+            LDAPI_REFLECT_FIELD(LandPermTable, environment),
+            LDAPI_REFLECT_FIELD(LandPermTable, role)
+        );
+    }
+};
+
+} // namespace land
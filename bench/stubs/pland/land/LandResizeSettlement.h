@@ -0,0 +1,14 @@
+#pragma once
+
+
+namespace land {
+
+struct LandResizeSettlement {
+    enum class Type { NoChange, Pay, Refund };
+
+    Type type{Type::NoChange};
+    int  newTotalPrice{0};
+    int  amount{0};
+};
+
+} // namespace land
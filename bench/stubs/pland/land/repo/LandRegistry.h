@@ -0,0 +1,211 @@
+#pragma once
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ll/api/reflection/Reflection.h"
+#include "pland/land/Land.h"
+
+
+namespace land {
+
+struct PlayerSettings {
+    bool showEnterLandTitle{true};
+    bool showBottomContinuedTip{true};
+
+    static constexpr auto reflection() {
+        return std::make_tuple(
+            LDAPI_REFLECT_FIELD(PlayerSettings, showEnterLandTitle),
+            LDAPI_REFLECT_FIELD(PlayerSettings, showBottomContinuedTip)
+        );
+    }
+};
+
+/**
+ * 宿主机版领地注册表
+ * 数据结构与 PLand 相同: ID -> 领地的哈希表 + 按维度、区块 (16x16) 划分的空间索引
+ * 各查询的复杂度与 PLand 一致 (getLands 系列为全表遍历，getLandAt 走区块索引)
+ */
+class LandRegistry {
+public:
+    void createSnapshot(std::optional<std::string>) {}
+
+    [[nodiscard]] bool isOperator(mce::UUID const& uuid) const { return mOperators.contains(uuid); }
+    bool               addOperator(mce::UUID const& uuid) { return mOperators.insert(uuid).second; }
+    bool               removeOperator(mce::UUID const& uuid) { return mOperators.erase(uuid) > 0; }
+
+    [[nodiscard]] std::vector<std::string> getOperators() const {
+        std::vector<std::string> result;
+        for (auto& uuid : mOperators) result.push_back(uuid.asString());
+        return result;
+    }
+
+    PlayerSettings& getOrCreatePlayerSettings(mce::UUID const& uuid) { return mPlayerSettings[uuid]; }
+
+    [[nodiscard]] bool hasLand(LandID id) const { return mLands.contains(id); }
+
+    ll::Expected<> addOrdinaryLand(SharedLand const& land) {
+        if (!land || land->mId != INVALID_LAND_ID) {
+            return ll::makeStringError("invalid land");
+        }
+        land->mId = mNextId++;
+        mLands.emplace(land->mId, land);
+        indexLand(*land);
+        return {};
+    }
+
+    ll::Expected<> removeOrdinaryLand(SharedLand const& land) {
+        if (!land || !mLands.contains(land->getId())) {
+            return ll::makeStringError("land not found");
+        }
+        unindexLand(*land);
+        mLands.erase(land->getId());
+        return {};
+    }
+
+    [[nodiscard]] SharedLand getLand(LandID id) const {
+        auto iter = mLands.find(id);
+        return iter == mLands.end() ? nullptr : iter->second;
+    }
+
+    [[nodiscard]] std::vector<SharedLand> getLands() const {
+        std::vector<SharedLand> result;
+        result.reserve(mLands.size());
+        for (auto& [id, land] : mLands) result.push_back(land);
+        return result;
+    }
+
+    [[nodiscard]] std::vector<SharedLand> getLands(LandDimid dimid) const {
+        std::vector<SharedLand> result;
+        for (auto& [id, land] : mLands) {
+            if (land->getDimensionId() == dimid) result.push_back(land);
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<SharedLand> getLands(mce::UUID const& uuid, bool includeShared = false) const {
+        std::vector<SharedLand> result;
+        for (auto& [id, land] : mLands) {
+            if (land->isOwner(uuid) || (includeShared && land->isMember(uuid))) result.push_back(land);
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<SharedLand> getLands(mce::UUID const& uuid, LandDimid dimid) const {
+        std::vector<SharedLand> result;
+        for (auto& [id, land] : mLands) {
+            if (land->getDimensionId() == dimid && land->isOwner(uuid)) result.push_back(land);
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<SharedLand> getLands(std::vector<LandID> const& ids) const {
+        std::vector<SharedLand> result;
+        for (auto id : ids) {
+            if (auto land = getLand(id)) result.push_back(std::move(land));
+        }
+        return result;
+    }
+
+    [[nodiscard]] LandPermType
+    getPermType(mce::UUID const& uuid, LandID id = INVALID_LAND_ID, bool includeOperator = true) const {
+        if (includeOperator && isOperator(uuid)) {
+            return LandPermType::Admin;
+        }
+        auto land = getLand(id);
+        return land ? land->getPermType(uuid) : LandPermType::Actor;
+    }
+
+    [[nodiscard]] SharedLand getLandAt(BlockPos const& pos, LandDimid dimid) const {
+        auto chunks = mChunkIndex.find(dimid);
+        if (chunks == mChunkIndex.end()) {
+            return nullptr;
+        }
+        auto ids = chunks->second.find(chunkId(pos.x >> 4, pos.z >> 4));
+        if (ids == chunks->second.end()) {
+            return nullptr;
+        }
+        for (auto id : ids->second) {
+            auto& land = mLands.at(id);
+            if (land->getAABB().hasPos(pos, land->is3D())) {
+                return land;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] std::unordered_set<SharedLand> getLandAt(BlockPos const& center, int radius, LandDimid dimid) const {
+        return getLandAt(
+            BlockPos{center.x - radius, center.y - radius, center.z - radius},
+            BlockPos{center.x + radius, center.y + radius, center.z + radius},
+            dimid
+        );
+    }
+
+    [[nodiscard]] std::unordered_set<SharedLand>
+    getLandAt(BlockPos const& a, BlockPos const& b, LandDimid dimid) const {
+        std::unordered_set<SharedLand> result;
+        auto                           chunks = mChunkIndex.find(dimid);
+        if (chunks == mChunkIndex.end()) {
+            return result;
+        }
+        auto area = LandAABB::make(LandPos::make(a), LandPos::make(b));
+        area.fix();
+        for (int cx = area.min.x >> 4; cx <= area.max.x >> 4; ++cx) {
+            for (int cz = area.min.z >> 4; cz <= area.max.z >> 4; ++cz) {
+                auto ids = chunks->second.find(chunkId(cx, cz));
+                if (ids == chunks->second.end()) continue;
+                for (auto id : ids->second) {
+                    auto& land = mLands.at(id);
+                    if (LandAABB::isCollision(land->getAABB(), area)) result.insert(land);
+                }
+            }
+        }
+        return result;
+    }
+
+    void refreshLandRange(SharedLand const& land) {
+        unindexLand(*land);
+        indexLand(*land);
+    }
+
+    [[nodiscard]] size_t size() const { return mLands.size(); }
+
+private:
+    static ChunkID chunkId(int cx, int cz) {
+        return (static_cast<ChunkID>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cz);
+    }
+
+    template <class F>
+    void forEachChunk(Land const& land, F&& fn) {
+        auto& aabb = land.getAABB();
+        for (int cx = aabb.min.x >> 4; cx <= aabb.max.x >> 4; ++cx) {
+            for (int cz = aabb.min.z >> 4; cz <= aabb.max.z >> 4; ++cz) fn(chunkId(cx, cz));
+        }
+    }
+
+    void indexLand(Land const& land) {
+        auto& chunks = mChunkIndex[land.getDimensionId()];
+        forEachChunk(land, [&](ChunkID id) { chunks[id].insert(land.getId()); });
+    }
+
+    void unindexLand(Land const& land) {
+        auto& chunks = mChunkIndex[land.getDimensionId()];
+        forEachChunk(land, [&](ChunkID id) {
+            if (auto iter = chunks.find(id); iter != chunks.end()) {
+                iter->second.erase(land.getId());
+                if (iter->second.empty()) chunks.erase(iter);
+            }
+        });
+    }
+
+    LandID                                                                             mNextId{0};
+    std::unordered_map<LandID, SharedLand>                                             mLands;
+    std::unordered_map<LandDimid, std::unordered_map<ChunkID, std::unordered_set<LandID>>> mChunkIndex;
+    std::unordered_set<mce::UUID>                                                      mOperators;
+    std::unordered_map<mce::UUID, PlayerSettings>                                      mPlayerSettings;
+};
+
+} // namespace land
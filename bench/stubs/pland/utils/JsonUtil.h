@@ -0,0 +1,41 @@
+#pragma once
+#include <type_traits>
+
+#include "ll/api/reflection/Reflection.h"
+#include "nlohmann/json.hpp"
+
+
+// 基于宿主机反射的 struct <-> json，遍历方式与 PLand 的 json_util 相同 (按成员逐个转换)
+namespace land::json_util {
+
+template <class T>
+nlohmann::json struct2json(T const& obj) {
+    auto result = nlohmann::json::object();
+    ll::reflection::forEachMember(obj, [&](std::string_view name, auto const& member) {
+        using M = std::remove_cvref_t<decltype(member)>;
+        if constexpr (std::is_class_v<M>) {
+            result[std::string{name}] = struct2json(member);
+        } else {
+            result[std::string{name}] = member;
+        }
+    });
+    return result;
+}
+
+template <class T>
+void json2structWithDiffPatch(nlohmann::json const& json, T& obj) {
+    ll::reflection::forEachMember(obj, [&](std::string_view name, auto& member) {
+        auto iter = json.find(name);
+        if (iter == json.end()) {
+            return;
+        }
+        using M = std::remove_cvref_t<decltype(member)>;
+        if constexpr (std::is_class_v<M>) {
+            json2structWithDiffPatch(*iter, member);
+        } else {
+            member = iter->template get<M>();
+        }
+    });
+}
+
+} // namespace land::json_util
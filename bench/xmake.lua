@@ -0,0 +1,16 @@
+-- 宿主机基准测试，不依赖 LeviLamina / BDS，可在 Linux / Windows 上直接构建运行
+-- 导出层源码直接编译进来，服务器 API 由 stubs/ 下的宿主机实现代替
+-- 构建并运行: xmake -P bench && xmake run -P bench [最大领地数量]
+add_rules("mode.release", "mode.debug")
+set_defaultmode("release")
+
+add_requires("nlohmann_json", "fmt", "magic_enum")
+
+target("PLand-LegacyRemoteCallApi-Bench")
+    set_kind("binary")
+    set_languages("c++20")
+    add_files("*.cc")
+    -- LeasingService / Command 依赖服务器的经济与命令系统，不参与基准
+    add_files("../src/exports/*.cc|LeasingService.cc|Command.cc")
+    add_includedirs("stubs", "../src")
+    add_packages("nlohmann_json", "fmt", "magic_enum")
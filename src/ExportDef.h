@@ -1,5 +1,7 @@
 #pragma once
+#include "exports/CallMetrics.h"
 #include "fmt/core.h"
+#include <functional>
 #include <string>
 
 #pragma warning(push, 0) // 禁用所有警告
@@ -19,6 +21,16 @@ inline bool exportAs(std::string const& sym, CB&& callback) {
 #ifdef LDAPI_COLLECT_EXPORT_SYMBOLS
     fmt::print("Exporting func: {} | {}\n", ExportNamespace, sym);
 #endif
+    if constexpr (InstrumentationEnabled) {
+        auto slot = CallMetrics::getInstance().allocate(sym);
+        if (slot != CallMetrics::NoSlot) {
+            return RemoteCall::exportAs(
+                ExportNamespace,
+                sym,
+                instrumentCall(slot, std::function{std::forward<CB>(callback)})
+            );
+        }
+    }
     return RemoteCall::exportAs(ExportNamespace, sym, std::move(callback));
 }
 
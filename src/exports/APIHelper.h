@@ -2,12 +2,16 @@
 #include "pland/Global.h"
 #include "pland/aabb/LandAABB.h"
 #include "pland/aabb/LandPos.h"
+#include "pland/land/LandPermTable.h"
 #include "pland/utils/JsonUtil.h"
 #include <pland/land/repo/LandContext.h>
 
 #include "pland/BuildInfo.h"
 
 #include "ExportDef.h"
+#include "exports/FfiProtocol.h"
+
+#include <functional>
 
 
 namespace ldapi {
@@ -45,16 +49,15 @@ struct Converter<land::LandPos> {
 // LandPermTable <-> std::string
 template <>
 struct Converter<land::LandPermTable> {
-    static std::string toLSE(land::LandPermTable const& table) {
+    static nlohmann::json toJson(land::LandPermTable const& table) {
 #ifndef PLAND_BUILD_MODE
-        auto j = land::json_util::struct2json(table); // <= v0.21.x
+        return land::json_util::struct2json(table); // <= v0.21.x
 #else
-        auto j = land::json_util::struct_to_json(table); // >= v0.22.x
+        return land::json_util::struct_to_json(table); // >= v0.22.x
 #endif
-        return j.dump();
     }
-    static land::LandPermTable toCpp(std::string const& json) {
-        auto                j = nlohmann::json::parse(json);
+    static std::string toLSE(land::LandPermTable const& table) { return toJson(table).dump(); }
+    static land::LandPermTable fromJson(nlohmann::json const& j) {
         land::LandPermTable table{};
 #ifndef PLAND_BUILD_MODE
         land::json_util::json2structWithDiffPatch(j, table); // <= v0.21.x
@@ -64,6 +67,7 @@ struct Converter<land::LandPermTable> {
 
         return table;
     }
+    static land::LandPermTable toCpp(std::string const& json) { return fromJson(nlohmann::json::parse(json)); }
 };
 
 
@@ -79,60 +83,25 @@ auto toCpp(Args&&... args) {
 }
 
 
-using FfiProtocol = std::string;
-
-inline FfiProtocol ffi_error(std::string const& msg) {
-    auto payload     = nlohmann::json{};
-    payload["ok"]    = false;
-    payload["error"] = msg;
-    return payload.dump();
-}
-template <typename... Args>
-inline FfiProtocol ffi_error(std::string_view fmt, Args&&... args) {
-    return ffi_error(fmt::vformat(fmt, fmt::make_format_args(std::forward<Args>(args)...)));
-}
-
-inline FfiProtocol ffi_success() {
-    auto payload  = nlohmann::json{};
-    payload["ok"] = true;
-    return payload.dump();
-}
-template <typename T>
-inline FfiProtocol ffi_success(T const& value) {
-    auto payload     = nlohmann::json{};
-    payload["ok"]    = true;
-    payload["value"] = value;
-    return payload.dump();
-}
-template <typename T, typename As>
-inline FfiProtocol ffi_success(T const& value, As&& as) {
-    return ffi_success(std::forward<As>(as)(value));
-}
-
-
-template <typename E>
-FfiProtocol as_ffi_protocol(E const& expected) {
-    if (expected) {
-        if constexpr (std::is_void_v<typename E::value_type>) {
-            return ffi_success(); // 无返回值 expected
-        } else {
-            return ffi_success(expected.value());
-        }
-    } else {
-        return ffi_error(expected.error().message());
+/**
+ * @brief 导出返回 FfiResult<T> 的函数
+ * 同时导出 JSON 协议 (sym) 与原生协议 (sym + "_Native")，后者仅在 T 可数值化时导出
+ */
+template <typename T, typename... Args>
+inline bool exportFfi(std::string const& sym, std::function<FfiResult<T>(Args...)> callback) {
+    bool ok = exportAs(sym, [callback](Args... args) -> FfiProtocol {
+        return ffi_encode_json(callback(std::forward<Args>(args)...));
+    });
+    if constexpr (FfiNativeValue<T>) {
+        ok &= exportAs(sym + "_Native", [callback](Args... args) -> FfiNativeProtocol {
+            return ffi_encode_native(callback(std::forward<Args>(args)...));
+        });
     }
+    return ok;
 }
-template <typename E, typename As>
-FfiProtocol as_ffi_protocol(E const& expected, As&& as) {
-    if (expected) {
-        if constexpr (std::is_void_v<typename E::value_type>) {
-            return ffi_success(); // 无返回值 expected
-        } else {
-            return ffi_success(std::forward<E>(expected), std::forward<As>(as));
-        }
-    } else {
-        return ffi_error(expected.error().message());
-    }
+template <typename CB>
+inline bool exportFfi(std::string const& sym, CB&& callback) {
+    return exportFfi(sym, std::function{std::forward<CB>(callback)});
 }
 
 
@@ -0,0 +1,74 @@
+#include "exports/CallMetrics.h"
+#include "ExportDef.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+
+
+namespace ldapi {
+
+
+std::vector<CallSnapshot> CallMetrics::top(size_t n) const {
+    std::vector<CallSnapshot> result;
+    for (size_t i = 0; i < mSize; ++i) {
+        auto& slot  = mSlots[i];
+        auto  calls = slot.calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        result.push_back({
+            slot.symbol,
+            calls,
+            slot.totalNs.load(std::memory_order_relaxed),
+            slot.maxNs.load(std::memory_order_relaxed),
+            slot.payloadBytes.load(std::memory_order_relaxed)
+        });
+    }
+
+    auto byTotal = [](CallSnapshot const& a, CallSnapshot const& b) { return a.totalNs > b.totalNs; };
+    if (result.size() > n) {
+        std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(n), result.end(), byTotal);
+        result.resize(n);
+    } else {
+        std::sort(result.begin(), result.end(), byTotal);
+    }
+    return result;
+}
+
+void CallMetrics::reset() {
+    for (size_t i = 0; i < mSize; ++i) {
+        auto& slot = mSlots[i];
+        slot.calls.store(0, std::memory_order_relaxed);
+        slot.totalNs.store(0, std::memory_order_relaxed);
+        slot.maxNs.store(0, std::memory_order_relaxed);
+        slot.payloadBytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+
+void Export_CallMetrics() {
+    exportAs("CallMetrics_setEnabled", [](bool enabled) -> void { CallMetrics::getInstance().setEnabled(enabled); });
+
+    exportAs("CallMetrics_isEnabled", []() -> bool { return CallMetrics::getInstance().isEnabled(); });
+
+    // [{symbol, calls, totalNs, maxNs, payloadBytes}]，按 totalNs 降序
+    exportAs("CallMetrics_getTop", [](int n) -> std::string {
+        auto result = nlohmann::json::array();
+        for (auto& snapshot : CallMetrics::getInstance().top(static_cast<size_t>(std::max(n, 0)))) {
+            result.push_back({
+                {"symbol",       snapshot.symbol      },
+                {"calls",        snapshot.calls       },
+                {"totalNs",      snapshot.totalNs     },
+                {"maxNs",        snapshot.maxNs       },
+                {"payloadBytes", snapshot.payloadBytes}
+            });
+        }
+        return result.dump();
+    });
+
+    exportAs("CallMetrics_reset", []() -> void { CallMetrics::getInstance().reset(); });
+}
+
+
+} // namespace ldapi
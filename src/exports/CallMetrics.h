@@ -0,0 +1,152 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "exports/TraceRecorder.h"
+
+
+namespace ldapi {
+
+
+/**
+ * 单个导出符号的调用统计
+ */
+struct CallSlot {
+    std::string           symbol;
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> maxNs{0};
+    std::atomic<uint64_t> payloadBytes{0}; // 仅统计 string / vector 返回值
+    uint32_t              traceName{TraceRecorder::NoName};
+
+    void record(uint64_t ns, uint64_t bytes) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        totalNs.fetch_add(ns, std::memory_order_relaxed);
+        payloadBytes.fetch_add(bytes, std::memory_order_relaxed);
+        auto current = maxNs.load(std::memory_order_relaxed);
+        while (ns > current && !maxNs.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {}
+    }
+};
+
+struct CallSnapshot {
+    std::string symbol;
+    uint64_t    calls;
+    uint64_t    totalNs;
+    uint64_t    maxNs;
+    uint64_t    payloadBytes;
+};
+
+/**
+ * 导出函数调用统计
+ * 每个符号在 exportAs 时分配固定槽位，调用路径按下标访问，不做查找
+ * 统计默认关闭 (定义 LDAPI_CALL_METRICS 时默认开启)，统计与 trace 均关闭时只多两次 relaxed load
+ * 未定义 LDAPI_INSTRUMENTATION 时导出函数不经过统计包装，setEnabled 无效
+ */
+class CallMetrics {
+public:
+    static constexpr size_t MaxSlots = 512;
+    static constexpr size_t NoSlot   = static_cast<size_t>(-1);
+
+    /// 为符号分配槽位 (重复导出复用原槽位)，槽位用尽时返回 NoSlot (该符号不统计)
+    size_t allocate(std::string const& symbol) {
+        for (size_t i = 0; i < mSize; ++i) {
+            if (mSlots[i].symbol == symbol) {
+                return i;
+            }
+        }
+        if (mSize >= MaxSlots) {
+            return NoSlot;
+        }
+        mSlots[mSize].symbol    = symbol;
+        mSlots[mSize].traceName = TraceRecorder::getInstance().intern(symbol, "export");
+        return mSize++;
+    }
+
+    [[nodiscard]] CallSlot& getSlot(size_t index) { return mSlots[index]; }
+
+    [[nodiscard]] bool isEnabled() const { return mEnabled.load(std::memory_order_relaxed); }
+
+    void setEnabled(bool enabled) { mEnabled.store(enabled && InstrumentationEnabled, std::memory_order_relaxed); }
+
+    /// 按累计耗时降序返回前 n 个有调用记录的符号
+    [[nodiscard]] std::vector<CallSnapshot> top(size_t n) const;
+
+    void reset();
+
+    static CallMetrics& getInstance() {
+        static CallMetrics instance;
+        return instance;
+    }
+
+private:
+    CallMetrics() = default;
+
+    std::array<CallSlot, MaxSlots> mSlots{};
+    size_t                         mSize{0};
+#if defined(LDAPI_CALL_METRICS) && defined(LDAPI_INSTRUMENTATION)
+    std::atomic<bool> mEnabled{true};
+#else
+    std::atomic<bool> mEnabled{false};
+#endif
+};
+
+
+// 返回值的负载大小 (字节)，非 string / vector 类型为 0
+template <typename T>
+inline uint64_t payloadSize(T const&) {
+    return 0;
+}
+inline uint64_t payloadSize(std::string const& value) { return value.size(); }
+template <typename T>
+inline uint64_t payloadSize(std::vector<T> const& value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return value.size() * sizeof(T);
+    } else {
+        uint64_t bytes = 0;
+        for (auto const& item : value) {
+            bytes += payloadSize(item);
+        }
+        return bytes;
+    }
+}
+
+// 记录一次调用的统计与时间线
+inline void finishCall(CallSlot& slot, std::chrono::steady_clock::time_point begin, uint64_t bytes) {
+    auto end = std::chrono::steady_clock::now();
+    TraceRecorder::getInstance().record(slot.traceName, begin, end);
+    if (CallMetrics::getInstance().isEnabled()) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        slot.record(static_cast<uint64_t>(ns), bytes);
+    }
+}
+
+template <typename Ret, typename... Args>
+inline auto instrumentCall(size_t slot, std::function<Ret(Args...)> callback) -> std::function<Ret(Args...)> {
+    return [slot, callback = std::move(callback)](Args... args) -> Ret {
+        auto& metrics = CallMetrics::getInstance();
+        if (!metrics.isEnabled() && !TraceRecorder::getInstance().isRecording()) {
+            return callback(std::forward<Args>(args)...);
+        }
+
+        auto& callSlot = metrics.getSlot(slot);
+        auto  begin    = std::chrono::steady_clock::now();
+        if constexpr (std::is_void_v<Ret>) {
+            callback(std::forward<Args>(args)...);
+            finishCall(callSlot, begin, 0);
+        } else {
+            auto result = callback(std::forward<Args>(args)...);
+            finishCall(callSlot, begin, payloadSize(result));
+            return result;
+        }
+    };
+}
+
+} // namespace ldapi
@@ -0,0 +1,166 @@
+#include "ll/api/command/CommandHandle.h"
+#include "ll/api/command/CommandRegistrar.h"
+
+#include "mc/server/commands/CommandOrigin.h"
+#include "mc/server/commands/CommandOutput.h"
+#include "mc/server/commands/CommandPermissionLevel.h"
+
+#include "fmt/chrono.h"
+#include "fmt/core.h"
+
+#include <chrono>
+#include <filesystem>
+
+#include "exports/CallMetrics.h"
+#include "exports/TraceRecorder.h"
+#include "mod/MyMod.h"
+#include "exports/LDEvents.h"
+
+
+namespace ldapi {
+
+
+constexpr size_t TopCalls = 20;
+
+static std::string formatLatency(uint64_t ns) {
+    if (ns >= 1'000'000) {
+        return fmt::format("{:.1f}ms", static_cast<double>(ns) / 1e6);
+    }
+    return fmt::format("{:.1f}us", static_cast<double>(ns) / 1e3);
+}
+
+static std::string formatStatsRow(std::string const& name, nlohmann::json const& stats) {
+    return fmt::format(
+        "{:<44} {:>9} {:>7} {:>5} {:>9} {:>9} {:>9}",
+        name,
+        stats["invocations"].get<uint64_t>(),
+        stats["cancels"].get<uint64_t>(),
+        stats["exceptions"].get<uint64_t>(),
+        formatLatency(stats["p50Ns"].get<uint64_t>()),
+        formatLatency(stats["p99Ns"].get<uint64_t>()),
+        formatLatency(stats["maxNs"].get<uint64_t>())
+    );
+}
+
+// ldapi stats: 按事件类型与监听器输出派发统计
+// ldapi stats reset: 清空统计
+// ldapi calls [on|off|reset]: 按累计耗时输出导出函数调用统计 / 开关 / 清空
+// ldapi trace start|stop: 录制导出函数调用与事件派发的时间线，写入数据目录下的 trace-*.json
+void Register_Command() {
+    auto& command = ll::command::CommandRegistrar::getInstance().getOrCreateCommand(
+        "ldapi",
+        "PLand LegacyRemoteCallApi diagnostics",
+        CommandPermissionLevel::GameDirectors
+    );
+
+    command.overload().text("stats").execute([](CommandOrigin const&, CommandOutput& output) {
+        auto stats  = collectEventStats();
+        auto header = fmt::format(
+            "{:<44} {:>9} {:>7} {:>5} {:>9} {:>9} {:>9}",
+            "event / listener",
+            "calls",
+            "cancel",
+            "exc",
+            "p50",
+            "p99",
+            "max"
+        );
+        output.success(header);
+        for (auto& [name, entry] : stats["events"].items()) {
+            output.success(formatStatsRow(name, entry));
+        }
+        for (auto& entry : stats["listeners"]) {
+            auto name = fmt::format(
+                "  #{} {} ({})",
+                entry["handle"].get<int>(),
+                entry["event"].get_ref<std::string const&>(),
+                entry["id"].get_ref<std::string const&>()
+            );
+            output.success(formatStatsRow(name, entry));
+        }
+    });
+
+    command.overload().text("stats").text("reset").execute([](CommandOrigin const&, CommandOutput& output) {
+        resetEventStats();
+        output.success("ldapi: event stats reset");
+    });
+
+    command.overload().text("calls").execute([](CommandOrigin const&, CommandOutput& output) {
+        auto& metrics = CallMetrics::getInstance();
+        if (!metrics.isEnabled()) {
+            output.success("ldapi: call metrics disabled, run 'ldapi calls on' first");
+        }
+        output.success(fmt::format(
+            "{:<44} {:>9} {:>10} {:>9} {:>9} {:>10}",
+            "symbol",
+            "calls",
+            "total",
+            "avg",
+            "max",
+            "payload"
+        ));
+        for (auto& snapshot : metrics.top(TopCalls)) {
+            output.success(fmt::format(
+                "{:<44} {:>9} {:>10} {:>9} {:>9} {:>10}",
+                snapshot.symbol,
+                snapshot.calls,
+                formatLatency(snapshot.totalNs),
+                formatLatency(snapshot.totalNs / snapshot.calls),
+                formatLatency(snapshot.maxNs),
+                snapshot.payloadBytes
+            ));
+        }
+    });
+
+    command.overload().text("calls").text("on").execute([](CommandOrigin const&, CommandOutput& output) {
+        if (!InstrumentationEnabled) {
+            output.error("ldapi: call metrics require a build with LDAPI_INSTRUMENTATION");
+            return;
+        }
+        CallMetrics::getInstance().setEnabled(true);
+        output.success("ldapi: call metrics enabled");
+    });
+
+    command.overload().text("calls").text("off").execute([](CommandOrigin const&, CommandOutput& output) {
+        CallMetrics::getInstance().setEnabled(false);
+        output.success("ldapi: call metrics disabled");
+    });
+
+    command.overload().text("calls").text("reset").execute([](CommandOrigin const&, CommandOutput& output) {
+        CallMetrics::getInstance().reset();
+        output.success("ldapi: call metrics reset");
+    });
+
+    command.overload().text("trace").text("start").execute([](CommandOrigin const&, CommandOutput& output) {
+        if (!InstrumentationEnabled) {
+            output.error("ldapi: trace requires a build with LDAPI_INSTRUMENTATION");
+            return;
+        }
+        if (!TraceRecorder::getInstance().start()) {
+            output.error("ldapi: trace is already recording");
+            return;
+        }
+        output.success("ldapi: trace recording started");
+    });
+
+    command.overload().text("trace").text("stop").execute([](CommandOrigin const&, CommandOutput& output) {
+        auto& recorder = TraceRecorder::getInstance();
+        if (!recorder.isRecording()) {
+            output.error("ldapi: trace is not recording");
+            return;
+        }
+        auto dir = my_mod::MyMod::getInstance().getSelf().getDataDir();
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+        auto path  = dir / fmt::format("trace-{:%Y%m%d-%H%M%S}.json", fmt::localtime(std::time(nullptr)));
+        auto count = recorder.stop(path);
+        if (!count) {
+            output.error(fmt::format("ldapi: failed to write {}", path.string()));
+            return;
+        }
+        output.success(fmt::format("ldapi: wrote {} trace events to {}", *count, path.string()));
+    });
+}
+
+
+} // namespace ldapi
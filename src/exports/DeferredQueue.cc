@@ -0,0 +1,90 @@
+#include "exports/DeferredQueue.h"
+
+#include "ll/api/chrono/GameChrono.h"
+#include "ll/api/coro/CoroTask.h"
+#include "ll/api/thread/ServerThreadExecutor.h"
+
+#include <algorithm>
+
+
+namespace ldapi {
+
+
+DeferredQueueStats& DeferredQueueStats::operator+=(DeferredQueueStats const& other) {
+    depth     += other.depth;
+    maxDepth   = std::max(maxDepth, other.maxDepth);
+    capacity  += other.capacity;
+    enqueued  += other.enqueued;
+    delivered += other.delivered;
+    dropped   += other.dropped;
+    coalesced += other.coalesced;
+    blocked   += other.blocked;
+    return *this;
+}
+
+void DeferredDispatcher::add(std::shared_ptr<DeferredQueueBase> queue) {
+    attach();
+    mQueues.push_back(std::move(queue));
+}
+
+void DeferredDispatcher::attach() {
+    if (mAttached) {
+        return;
+    }
+    mAttached = true;
+
+    ll::coro::keepThis([this]() -> ll::coro::CoroTask<> {
+        while (true) {
+            co_await ll::chrono::ticks{1};
+            drain(mBudget);
+        }
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
+}
+
+void DeferredDispatcher::drain(std::chrono::steady_clock::duration budget) {
+    auto deadline = std::chrono::steady_clock::now() + budget;
+
+    // 回调中可能注册新的延迟监听器，只处理本轮开始时已有的队列
+    auto queues = mQueues;
+    bool pending = true;
+    while (pending && std::chrono::steady_clock::now() < deadline) {
+        pending = false;
+        for (auto& queue : queues) {
+            if (queue->deliverOne()) {
+                pending = true;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+        }
+    }
+
+    // 移除前把计数并入累计统计，总数不会因监听器移除而减少；未投递的事件计为丢弃
+    std::erase_if(mQueues, [this](auto const& queue) {
+        if (!queue->isClosed()) {
+            return false;
+        }
+        auto stats      = queue->getStats();
+        stats.dropped  += stats.depth;
+        stats.depth     = 0;
+        stats.capacity  = 0;
+        mClosedStats   += stats;
+        return true;
+    });
+}
+
+DeferredQueueStats DeferredDispatcher::getTotalStats() const {
+    DeferredQueueStats total = mClosedStats;
+    for (auto& queue : mQueues) {
+        total += queue->getStats();
+    }
+    return total;
+}
+
+DeferredDispatcher& DeferredDispatcher::getInstance() {
+    static DeferredDispatcher instance;
+    return instance;
+}
+
+
+} // namespace ldapi
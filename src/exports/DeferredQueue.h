@@ -0,0 +1,205 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+namespace ldapi {
+
+
+/// 延迟队列已满时的处理策略
+enum class OverflowPolicy {
+    DropOldest, // 丢弃最旧的事件
+    Block,      // 在当前调用中同步投递最旧的事件以腾出空间 (等同于回退为同步投递)
+    Coalesce,   // 已满时若队列中有同一领地且参数相同的事件则替换之，否则丢弃最旧的事件
+};
+
+struct DeferredOptions {
+    OverflowPolicy policy{OverflowPolicy::DropOldest};
+    size_t         capacity{1024};
+};
+
+struct DeferredQueueStats {
+    size_t   depth{0};     // 当前排队数
+    size_t   maxDepth{0};  // 历史最大排队数
+    size_t   capacity{0};  // 容量
+    uint64_t enqueued{0};  // 入队次数
+    uint64_t delivered{0}; // 已投递次数
+    uint64_t dropped{0};   // 因溢出、投递时玩家已离线或监听器已移除而丢弃的次数
+    uint64_t coalesced{0}; // 已满时被相同的新事件替换的次数
+    uint64_t blocked{0};   // 队列已满时同步投递的次数
+
+    DeferredQueueStats& operator+=(DeferredQueueStats const& other);
+};
+
+class DeferredQueueBase {
+public:
+    virtual ~DeferredQueueBase() = default;
+
+    /// 投递队首事件，队列为空时返回 false
+    virtual bool deliverOne() = 0;
+
+    void close() { mClosed = true; }
+
+    [[nodiscard]] bool isClosed() const { return mClosed; }
+
+    [[nodiscard]] DeferredQueueStats const& getStats() const { return mStats; }
+
+protected:
+    DeferredQueueStats mStats;
+    bool               mClosed{false};
+};
+
+/**
+ * 单个监听器的延迟投递队列
+ * 事件参数在入队时复制一份，由 DeferredDispatcher 在每 tick 的时间预算内投递
+ */
+template <typename Payload>
+class DeferredQueue final : public DeferredQueueBase {
+public:
+    /// 返回 false 表示事件已无法投递 (例如玩家已离线)
+    using Deliver = std::function<bool(Payload const&)>;
+
+    DeferredQueue(DeferredOptions options, Deliver deliver) : mOptions(options), mDeliver(std::move(deliver)) {
+        mStats.capacity = options.capacity;
+    }
+
+    void push(std::shared_ptr<Payload const> payload, int64_t key) {
+        if (mClosed) {
+            return;
+        }
+        ++mStats.enqueued;
+
+        auto full = mEntries.size() >= mOptions.capacity;
+        if (full && mOptions.policy == OverflowPolicy::Coalesce && coalesce(payload, key)) {
+            ++mStats.coalesced;
+            return;
+        }
+
+        while (mEntries.size() >= mOptions.capacity && !mEntries.empty()) {
+            if (mOptions.policy == OverflowPolicy::Block) {
+                ++mStats.blocked;
+                deliverOne();
+            } else {
+                popFront();
+                ++mStats.dropped;
+            }
+        }
+        auto seq = mNextSeq++;
+        if (mOptions.policy == OverflowPolicy::Coalesce && key >= 0) {
+            mSlots.emplace(key, seq);
+        }
+        mEntries.push_back({std::move(payload), key, seq});
+        mStats.depth    = mEntries.size();
+        mStats.maxDepth = std::max(mStats.maxDepth, mStats.depth);
+    }
+
+    bool deliverOne() override {
+        if (mEntries.empty()) {
+            return false;
+        }
+        auto payload = popFront();
+        if (mClosed) {
+            ++mStats.dropped;
+            return true;
+        }
+        if (mDeliver(*payload)) {
+            ++mStats.delivered;
+        } else {
+            ++mStats.dropped;
+        }
+        return true;
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<Payload const> payload; // 同一事件的多个延迟订阅者共享一份参数
+        int64_t                        key;     // 领地 ID，-1 表示不参与合并
+        uint64_t                       seq;     // 入队序号，与队首序号之差即在队列中的位置
+    };
+
+    /**
+     * 在同一领地的排队事件中查找参数相同的一条，以新事件替换
+     * 每个队列只属于一个事件类型的订阅者，因此 (领地 ID, 参数) 即可唯一确定一个事件；
+     * 参数不同的事件 (例如同一领地的不同成员变更) 都是真实的状态变化，不合并
+     */
+    bool coalesce(std::shared_ptr<Payload const>& payload, int64_t key) {
+        if constexpr (std::equality_comparable<Payload>) {
+            if (key < 0 || mEntries.empty()) {
+                return false;
+            }
+            auto [begin, end] = mSlots.equal_range(key);
+            for (auto iter = begin; iter != end; ++iter) {
+                auto& entry = mEntries[iter->second - mEntries.front().seq];
+                if (*entry.payload == *payload) {
+                    entry.payload = std::move(payload);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    std::shared_ptr<Payload const> popFront() {
+        auto& front = mEntries.front();
+        if (front.key >= 0 && !mSlots.empty()) {
+            auto [begin, end] = mSlots.equal_range(front.key);
+            for (auto iter = begin; iter != end; ++iter) {
+                if (iter->second == front.seq) {
+                    mSlots.erase(iter);
+                    break;
+                }
+            }
+        }
+        auto payload = std::move(front.payload);
+        mEntries.pop_front();
+        mStats.depth = mEntries.size();
+        return payload;
+    }
+
+    DeferredOptions                            mOptions;
+    Deliver                                    mDeliver;
+    std::deque<Entry>                          mEntries;
+    std::unordered_multimap<int64_t, uint64_t> mSlots; // 领地 ID -> 排队中的事件序号，仅 Coalesce 策略使用
+    uint64_t                                   mNextSeq{0};
+};
+
+/**
+ * 延迟队列调度器
+ * 每 tick 在时间预算内轮流从各队列投递一条事件，预算用尽后剩余事件留到下一 tick
+ */
+class DeferredDispatcher {
+public:
+    static constexpr auto DefaultBudget = std::chrono::microseconds{2000};
+
+    void add(std::shared_ptr<DeferredQueueBase> queue);
+
+    void drain(std::chrono::steady_clock::duration budget);
+
+    void setBudget(std::chrono::microseconds budget) { mBudget = budget; }
+
+    /// 所有队列的统计之和，包括已移除的队列
+    [[nodiscard]] DeferredQueueStats getTotalStats() const;
+
+    static DeferredDispatcher& getInstance();
+
+private:
+    DeferredDispatcher() = default;
+
+    void attach();
+
+    bool                                            mAttached{false};
+    std::chrono::microseconds                       mBudget{DefaultBudget};
+    std::vector<std::shared_ptr<DeferredQueueBase>> mQueues;
+    DeferredQueueStats                              mClosedStats; // 已移除队列的累计统计
+};
+
+
+} // namespace ldapi
@@ -0,0 +1,296 @@
+#pragma once
+#include "ll/api/event/EventBus.h"
+#include "ll/api/event/ListenerBase.h"
+#include "ll/api/service/Bedrock.h"
+
+#include "mc/world/actor/player/Player.h"
+#include "mc/world/level/Level.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "exports/DeferredQueue.h"
+#include "exports/EventStats.h"
+#include "exports/LDEvents.h"
+
+
+namespace ldapi {
+
+
+class EventChannelBase {
+public:
+    virtual ~EventChannelBase() = default;
+
+    virtual bool unsubscribe(int handle) = 0;
+
+    /// 延迟投递队列统计，订阅者不存在或为同步投递时返回 nullptr
+    [[nodiscard]] virtual DeferredQueueStats const* getQueueStats(int handle) const = 0;
+
+    /// 派发时发现导出函数已不存在而移除的旧式订阅者句柄，由 ScriptEventManager 取走后清理
+    static std::vector<int>& droppedHandles() {
+        static std::vector<int> handles;
+        return handles;
+    }
+};
+
+/// 事件是否可拦截 (Before 类事件)
+template <typename E>
+constexpr bool EventCancellable = requires(E& ev) { ev.cancel(); };
+
+/// 延迟队列的合并键
+template <typename E>
+int64_t getEventLandKey(E const& ev) {
+    if constexpr (requires { ev.land(); }) {
+        auto land = ev.land();
+        return land ? static_cast<int64_t>(land->getId()) : -1;
+    } else if constexpr (requires { ev.landId(); }) {
+        return static_cast<int64_t>(ev.landId());
+    } else {
+        return -1;
+    }
+}
+
+/**
+ * 延迟投递时参数的保存形式
+ * Player* 保存为 UUID，投递时重新查找，玩家已离线则放弃投递
+ */
+template <typename T>
+struct DeferredArg {
+    using Stored = T;
+
+    static Stored store(T const& value) { return value; }
+    static bool   restore(Stored const& stored, T& out) {
+        out = stored;
+        return true;
+    }
+};
+
+template <>
+struct DeferredArg<Player*> {
+    using Stored = mce::UUID;
+
+    static Stored store(Player* player) { return player ? player->getUuid() : mce::UUID{}; }
+    static bool   restore(Stored const& uuid, Player*& out) {
+        auto level = ll::service::getLevel();
+        out        = level ? level->getPlayer(uuid) : nullptr;
+        return out != nullptr;
+    }
+};
+
+/**
+ * 单个事件类型的脚本订阅通道
+ * 每个事件类型只向 EventBus 注册一个原生监听器，参数只转换一次后按注册顺序分发给所有订阅者；
+ * 可拦截事件在第一个返回 false 的订阅者处拦截并停止分发
+ */
+template <typename E, typename Sig>
+class EventChannel;
+
+template <typename E, typename... Args>
+class EventChannel<E, bool(Args...)> final : public EventChannelBase {
+public:
+    using Callback          = std::function<bool(Args...)>;
+    using Arguments         = std::tuple<Args...>;
+    using DeferredArguments = std::tuple<typename DeferredArg<Args>::Stored...>;
+    using Converter         = Arguments (*)(E&);
+
+    struct Subscriber {
+        int                                               handle;
+        std::optional<ScriptCallbackGuard>                guard;    // 仅旧式注册，指定了所属脚本时为空
+        std::optional<EventFilter>                        filter;
+        std::optional<DeferredOptions>                    deferred; // 仅不可拦截的事件可以延迟投递
+        std::shared_ptr<ListenerCounters>                 counters;
+        Callback                                          callback;
+        std::shared_ptr<DeferredQueue<DeferredArguments>> queue{};
+        bool                                              removed{false};
+    };
+
+    bool subscribe(std::string const& eventName, Subscriber subscriber, Converter converter) {
+        if (subscriber.deferred) {
+            if constexpr (EventCancellable<E>) {
+                return false;
+            } else {
+                subscriber.queue = makeQueue(subscriber);
+                DeferredDispatcher::getInstance().add(subscriber.queue);
+            }
+        }
+
+        if (!mStats) {
+            mStats = &EventStatsRegistry::getInstance().getEventStats(eventName);
+        }
+        mConverter = converter;
+        mSubscribers.push_back(std::make_unique<Subscriber>(std::move(subscriber)));
+        if (!mListener) {
+            mListener = ll::event::EventBus::getInstance().emplaceListener<E>([this](E& ev) { dispatch(ev); });
+        }
+        return true;
+    }
+
+    bool unsubscribe(int handle) override {
+        for (auto& subscriber : mSubscribers) {
+            if (subscriber->handle == handle && !subscriber->removed) {
+                subscriber->removed = true;
+                if (mDepth == 0) {
+                    compact();
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] DeferredQueueStats const* getQueueStats(int handle) const override {
+        for (auto& subscriber : mSubscribers) {
+            if (subscriber->handle == handle && subscriber->queue) {
+                return &subscriber->queue->getStats();
+            }
+        }
+        return nullptr;
+    }
+
+    static EventChannel& getInstance() {
+        static EventChannel instance;
+        return instance;
+    }
+
+private:
+    EventChannel() = default;
+
+    static std::shared_ptr<DeferredQueue<DeferredArguments>> makeQueue(Subscriber const& subscriber) {
+        return std::make_shared<DeferredQueue<DeferredArguments>>(
+            *subscriber.deferred,
+            [guard    = subscriber.guard,
+             counters = subscriber.counters,
+             callback = subscriber.callback](DeferredArguments const& stored) -> bool {
+                Arguments args;
+                if ((guard && !guard->isAlive()) || !restore(stored, args)) {
+                    return false;
+                }
+                ++counters->delivered;
+                auto begin = std::chrono::steady_clock::now();
+                bool threw = false;
+                try {
+                    std::apply(callback, args);
+                } catch (...) {
+                    threw = true;
+                }
+                counters->dispatch.record(begin, false, threw);
+                return true;
+            }
+        );
+    }
+
+    static DeferredArguments store(Arguments const& args) {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return DeferredArguments{DeferredArg<Args>::store(std::get<I>(args))...};
+        }(std::index_sequence_for<Args...>{});
+    }
+
+    static bool restore(DeferredArguments const& stored, Arguments& out) {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return (DeferredArg<Args>::restore(std::get<I>(stored), std::get<I>(out)) && ...);
+        }(std::index_sequence_for<Args...>{});
+    }
+
+    void dispatch(E& ev) {
+        ++mDepth;
+        auto dispatchBegin = std::chrono::steady_clock::now();
+        bool cancelled     = false;
+        bool threw         = false;
+
+        std::optional<Arguments>                 args; // 首个需要投递的订阅者出现时才转换参数
+        std::shared_ptr<DeferredArguments const> deferredArgs;
+        land::SharedLand                         land;
+        bool                                     landResolved = false;
+
+        // 回调中新增的订阅者从下一次事件开始生效
+        auto count = mSubscribers.size();
+        for (size_t i = 0; i < count; ++i) {
+            auto* subscriber = mSubscribers[i].get();
+            if (subscriber->removed) {
+                continue;
+            }
+            if (subscriber->guard && !subscriber->guard->isAlive()) {
+                subscriber->removed = true;
+                droppedHandles().push_back(subscriber->handle);
+                continue;
+            }
+            if (subscriber->filter) {
+                if (!landResolved) {
+                    land         = getEventLand(ev);
+                    landResolved = true;
+                }
+                if (!land || !subscriber->filter->matches(*land)) {
+                    ++subscriber->counters->skipped;
+                    continue;
+                }
+            }
+
+            if (!args) {
+                args.emplace(mConverter(ev));
+            }
+            if (subscriber->queue) {
+                if (!deferredArgs) {
+                    deferredArgs = std::make_shared<DeferredArguments const>(store(*args));
+                }
+                subscriber->queue->push(deferredArgs, getEventLandKey(ev));
+                continue;
+            }
+
+            ++subscriber->counters->delivered;
+            auto callbackBegin = std::chrono::steady_clock::now();
+            bool result        = true;
+            bool callbackThrew = false;
+            try {
+                result = std::apply(subscriber->callback, *args);
+            } catch (...) {
+                callbackThrew = true;
+            }
+            bool callbackCancelled = EventCancellable<E> && !result;
+            subscriber->counters->dispatch.record(callbackBegin, callbackCancelled, callbackThrew);
+            threw = threw || callbackThrew;
+            if constexpr (EventCancellable<E>) {
+                if (callbackCancelled) {
+                    ev.cancel();
+                    cancelled = true;
+                    break;
+                }
+            }
+        }
+        mStats->record(dispatchBegin, cancelled, threw);
+
+        if (--mDepth == 0) {
+            compact();
+        }
+    }
+
+    // 分发过程中只做标记，回到最外层后再移除，保证分发时下标与指针稳定
+    void compact() {
+        std::erase_if(mSubscribers, [](auto const& subscriber) {
+            if (subscriber->removed && subscriber->queue) {
+                subscriber->queue->close();
+            }
+            return subscriber->removed;
+        });
+        if (mSubscribers.empty() && mListener) {
+            ll::event::EventBus::getInstance().removeListener(mListener);
+            mListener = nullptr;
+        }
+    }
+
+    DispatchStats*                           mStats{nullptr}; // 事件类型级别的统计
+    Converter                                mConverter{nullptr};
+    ll::event::ListenerPtr                   mListener;
+    std::vector<std::unique_ptr<Subscriber>> mSubscribers;
+    int                                      mDepth{0}; // 分发嵌套深度
+};
+
+
+} // namespace ldapi
@@ -0,0 +1,83 @@
+#include "exports/EventStats.h"
+
+#include <algorithm>
+#include <bit>
+
+
+namespace ldapi {
+
+
+void LatencyHistogram::record(uint64_t ns) {
+    auto bucket = std::min<size_t>(ns == 0 ? 0 : std::bit_width(ns) - 1, Buckets - 1);
+    mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    auto current = mMax.load(std::memory_order_relaxed);
+    while (ns > current && !mMax.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {}
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    std::array<uint64_t, Buckets> counts{};
+    uint64_t                      total = 0;
+    for (size_t i = 0; i < Buckets; ++i) {
+        counts[i]  = mBuckets[i].load(std::memory_order_relaxed);
+        total     += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    auto     rank = static_cast<uint64_t>(p * static_cast<double>(total - 1)) + 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < Buckets; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return std::min(uint64_t{1} << (i + 1), max());
+        }
+    }
+    return max();
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : mBuckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    mMax.store(0, std::memory_order_relaxed);
+}
+
+void DispatchStats::record(std::chrono::steady_clock::time_point begin, bool cancelled, bool threw) {
+    auto end = std::chrono::steady_clock::now();
+    TraceRecorder::getInstance().record(traceName, begin, end);
+
+    invocations.fetch_add(1, std::memory_order_relaxed);
+    if (cancelled) {
+        cancels.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (threw) {
+        exceptions.fetch_add(1, std::memory_order_relaxed);
+    }
+    latency.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+}
+
+void DispatchStats::reset() {
+    invocations.store(0, std::memory_order_relaxed);
+    cancels.store(0, std::memory_order_relaxed);
+    exceptions.store(0, std::memory_order_relaxed);
+    latency.reset();
+}
+
+DispatchStats& EventStatsRegistry::getEventStats(std::string const& eventName) {
+    auto& stats = mEvents[eventName];
+    if (!stats) {
+        stats            = std::make_unique<DispatchStats>();
+        stats->traceName = TraceRecorder::getInstance().intern(eventName, "event");
+    }
+    return *stats;
+}
+
+EventStatsRegistry& EventStatsRegistry::getInstance() {
+    static EventStatsRegistry instance;
+    return instance;
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "exports/TraceRecorder.h"
+
+
+namespace ldapi {
+
+
+/**
+ * 以 2 的幂划分桶的延迟直方图 (桶 i 覆盖 [2^i, 2^(i+1)) 纳秒)
+ * 记录只有几次 relaxed 原子操作，可以在生产环境常开
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t Buckets = 40; // 最大约 18 分钟
+
+    void record(uint64_t ns);
+
+    /// 百分位数，返回所在桶的上界 (纳秒)
+    [[nodiscard]] uint64_t percentile(double p) const;
+
+    [[nodiscard]] uint64_t max() const { return mMax.load(std::memory_order_relaxed); }
+
+    void reset();
+
+private:
+    std::array<std::atomic<uint64_t>, Buckets> mBuckets{};
+    std::atomic<uint64_t>                      mMax{0};
+};
+
+/**
+ * 一组派发的统计 (某个事件类型，或某个脚本监听器)
+ */
+struct DispatchStats {
+    std::atomic<uint64_t> invocations{0};
+    std::atomic<uint64_t> cancels{0};
+    std::atomic<uint64_t> exceptions{0};
+    LatencyHistogram      latency;
+    uint32_t              traceName{TraceRecorder::NoName};
+
+    /// 记录一次从 begin 到现在的派发 (录制 trace 时同时写入时间线)
+    void record(std::chrono::steady_clock::time_point begin, bool cancelled, bool threw);
+
+    void reset();
+};
+
+/**
+ * 按事件类型汇总的派发统计
+ * 统计对象只在首次注册该事件时创建，之后地址不变，派发路径直接持有指针
+ */
+class EventStatsRegistry {
+public:
+    DispatchStats& getEventStats(std::string const& eventName);
+
+    [[nodiscard]] std::map<std::string, std::unique_ptr<DispatchStats>> const& getAll() const { return mEvents; }
+
+    static EventStatsRegistry& getInstance();
+
+private:
+    EventStatsRegistry() = default;
+
+    std::map<std::string, std::unique_ptr<DispatchStats>> mEvents;
+};
+
+
+} // namespace ldapi
@@ -0,0 +1,14 @@
+#include "ExportDef.h"
+#include "exports/FfiProtocol.h"
+
+
+namespace ldapi {
+
+
+void Export_Ffi() {
+    // 原生协议的错误信息按需获取，成功路径不产生任何字符串
+    exportAs("Ffi_getError", [](int index) -> std::string { return FfiErrorTable::getInstance().get(index); });
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,193 @@
+#pragma once
+#include "fmt/core.h"
+#include "nlohmann/json.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace ldapi {
+
+
+// JSON 协议: {"ok": bool, "value"?: T, "error"?: string}
+using FfiProtocol = std::string;
+
+// 原生协议: [status, errorIndex, value?]，成功路径不构造、不解析 JSON
+// 失败时 errorIndex 指向 FfiErrorTable 中的错误信息，脚本仅在失败时通过 Ffi_getError 取回
+using FfiNativeProtocol = std::vector<int64_t>;
+
+enum class FfiStatus : int64_t { Ok = 0, Error = 1 };
+
+// 可直接以数值形式放入原生协议的返回值类型
+template <typename T>
+concept FfiNativeValue = std::is_void_v<T> || std::integral<T> || std::is_enum_v<T>;
+
+
+// 失败结果，可隐式转换为任意 FfiResult<T>
+struct FfiError {
+    std::string message;
+};
+
+template <typename T = void>
+class FfiResult {
+public:
+    FfiResult(T value) : mValue(std::move(value)) {}                 // NOLINT(google-explicit-constructor)
+    FfiResult(FfiError error) : mError(std::move(error.message)) {} // NOLINT(google-explicit-constructor)
+
+    [[nodiscard]] bool               ok() const { return !mError.has_value(); }
+    [[nodiscard]] T const&           value() const { return *mValue; }
+    [[nodiscard]] std::string const& error() const { return *mError; }
+
+private:
+    std::optional<T>           mValue;
+    std::optional<std::string> mError;
+};
+
+template <>
+class FfiResult<void> {
+public:
+    FfiResult() = default;
+    FfiResult(FfiError error) : mError(std::move(error.message)) {} // NOLINT(google-explicit-constructor)
+
+    [[nodiscard]] bool               ok() const { return !mError.has_value(); }
+    [[nodiscard]] std::string const& error() const { return *mError; }
+
+private:
+    std::optional<std::string> mError;
+};
+
+
+/**
+ * 原生协议的错误信息表 (环形缓冲)
+ * 索引单调递增，被覆盖的旧索引会返回过期提示
+ */
+class FfiErrorTable {
+public:
+    static constexpr int Capacity = 256;
+
+    int push(std::string message) {
+        auto index                  = mNextIndex;
+        mNextIndex                  = (mNextIndex + 1) & 0x7FFFFFFF;
+        mMessages[index % Capacity] = {index, std::move(message)};
+        return index;
+    }
+
+    [[nodiscard]] std::string get(int index) const {
+        if (index < 0) {
+            return {};
+        }
+        auto& [slotIndex, message] = mMessages[index % Capacity];
+        if (slotIndex != index) {
+            return fmt::format("error message #{} expired", index);
+        }
+        return message;
+    }
+
+    static FfiErrorTable& getInstance() {
+        static FfiErrorTable instance;
+        return instance;
+    }
+
+private:
+    int                                               mNextIndex{0};
+    std::array<std::pair<int, std::string>, Capacity> mMessages{};
+};
+
+
+// payload 为未序列化的协议对象，用于嵌套在批量结果中
+inline nlohmann::json ffi_error_payload(std::string const& msg) {
+    auto payload     = nlohmann::json{};
+    payload["ok"]    = false;
+    payload["error"] = msg;
+    return payload;
+}
+inline nlohmann::json ffi_success_payload() {
+    auto payload  = nlohmann::json{};
+    payload["ok"] = true;
+    return payload;
+}
+template <typename T>
+inline nlohmann::json ffi_success_payload(T const& value) {
+    auto payload     = nlohmann::json{};
+    payload["ok"]    = true;
+    payload["value"] = value;
+    return payload;
+}
+
+
+inline FfiError ffi_error(std::string msg) { return FfiError{std::move(msg)}; }
+template <typename... Args>
+inline FfiError ffi_error(std::string_view fmt, Args&&... args) {
+    return ffi_error(fmt::vformat(fmt, fmt::make_format_args(std::forward<Args>(args)...)));
+}
+
+inline FfiResult<> ffi_success() { return {}; }
+template <typename T>
+inline FfiResult<T> ffi_success(T value) {
+    return FfiResult<T>{std::move(value)};
+}
+template <typename T, typename As>
+inline auto ffi_success(T const& value, As&& as) {
+    return ffi_success(std::forward<As>(as)(value));
+}
+
+
+template <typename E>
+auto as_ffi_result(E const& expected) -> FfiResult<typename E::value_type> {
+    if (!expected) {
+        return ffi_error(expected.error().message());
+    }
+    if constexpr (std::is_void_v<typename E::value_type>) {
+        return ffi_success(); // 无返回值 expected
+    } else {
+        return ffi_success(expected.value());
+    }
+}
+// 无返回值的 expected 使用无参的 as 生成返回值
+template <typename E, typename As>
+auto as_ffi_result(E const& expected, As&& as) {
+    if constexpr (std::is_void_v<typename E::value_type>) {
+        using R = FfiResult<std::invoke_result_t<As>>;
+        if (!expected) return R{ffi_error(expected.error().message())};
+        return R{std::forward<As>(as)()};
+    } else {
+        using R = FfiResult<std::invoke_result_t<As, typename E::value_type const&>>;
+        if (!expected) return R{ffi_error(expected.error().message())};
+        return R{std::forward<As>(as)(expected.value())};
+    }
+}
+
+
+template <typename T>
+FfiProtocol ffi_encode_json(FfiResult<T> const& result) {
+    if (!result.ok()) {
+        return ffi_error_payload(result.error()).dump();
+    }
+    if constexpr (std::is_void_v<T>) {
+        return ffi_success_payload().dump();
+    } else {
+        return ffi_success_payload(result.value()).dump();
+    }
+}
+
+template <FfiNativeValue T>
+FfiNativeProtocol ffi_encode_native(FfiResult<T> const& result) {
+    if (!result.ok()) {
+        auto index = FfiErrorTable::getInstance().push(result.error());
+        return {static_cast<int64_t>(FfiStatus::Error), index};
+    }
+    if constexpr (std::is_void_v<T>) {
+        return {static_cast<int64_t>(FfiStatus::Ok), -1};
+    } else {
+        return {static_cast<int64_t>(FfiStatus::Ok), -1, static_cast<int64_t>(result.value())};
+    }
+}
+
+
+} // namespace ldapi
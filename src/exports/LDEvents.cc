@@ -1,5 +1,6 @@
 #include "ll/api/event/EventBus.h"
 #include "ll/api/event/ListenerBase.h"
+#include "ll/api/mod/ModManagerRegistry.h"
 #include "ll/api/utils/HashUtils.h"
 
 #include "mc/world/actor/player/Player.h"
@@ -37,6 +38,11 @@
 
 #include "pland/land/LandResizeSettlement.h"
 
+#include "ll/api/chrono/GameChrono.h"
+#include "ll/api/coro/CoroTask.h"
+#include "ll/api/thread/ServerThreadExecutor.h"
+
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -44,6 +50,10 @@
 
 
 #include "ExportDef.h"
+#include "exports/EventChannel.h"
+#include "exports/LDEvents.h"
+#include "exports/LandPresenceBatch.h"
+#include "exports/UUIDCache.h"
 
 namespace ldapi {
 
@@ -51,18 +61,116 @@ namespace ldapi {
 using namespace ll::hash_utils;
 class ScriptEventManager {
 private:
-    int64                                             mListenerCount{0}; // 监听器计数
-    std::unordered_map<int64, ll::event::ListenerPtr> mListeners;        // 监听器列表 (key: ScriptEventID)
+    int64                                                    mListenerCount{0}; // 监听器计数
+    int                                                      mNextHandle{0};    // 监听器句柄
+    std::unordered_map<int, EventChannelBase*>               mListeners;        // 监听器所在通道 (key: 句柄)
+    std::unordered_map<int, std::weak_ptr<ListenerCounters>> mCounters;         // 投递统计 (key: 句柄)
+    std::unordered_map<int, std::weak_ptr<ll::mod::Mod>>     mOwners;           // 监听器所属脚本 (key: 句柄)
+    bool                                                     mAttached{false};
+
+    // 每 tick 检查一次所属脚本，已卸载或禁用的脚本的监听器全部移除；派发路径上不再检查
+    // 旧式注册由通道在派发时发现失效并移除，这里只清理句柄
+    void attach() {
+        if (mAttached) {
+            return;
+        }
+        mAttached = true;
+
+        ll::coro::keepThis([this]() -> ll::coro::CoroTask<> {
+            while (true) {
+                co_await ll::chrono::ticks{1};
+                sweep();
+            }
+        }).launch(ll::thread::ServerThreadExecutor::getDefault());
+    }
+    void sweep() {
+        for (auto handle : std::exchange(EventChannelBase::droppedHandles(), {})) {
+            mListeners.erase(handle);
+        }
+        std::vector<int> unloaded;
+        for (auto& [handle, weak] : mOwners) {
+            auto owner = weak.lock();
+            if (!owner || !owner->isEnabled()) {
+                unloaded.push_back(handle);
+            }
+        }
+        for (auto handle : unloaded) {
+            removeListener(handle);
+        }
+    }
 
 public:
     std::string genListenerID() { return fmt::format("{}_Event_{}", ExportNamespace, mListenerCount++); }
 
-    void addListener(std::string const& scriptEventID, ll::event::ListenerPtr listener) {
-        mListeners[doHash(scriptEventID)] = std::move(listener);
+    int nextHandle() { return mNextHandle++; }
+
+    // 统计由监听器持有，监听器销毁后自动失效
+    // 时间线名称按 "事件 @ 所属脚本" 复用，不随监听器数量增长
+    std::shared_ptr<ListenerCounters> createCounters(
+        int                                  handle,
+        std::string const&                   eventName,
+        std::string const&                   scriptEventID,
+        std::shared_ptr<ll::mod::Mod> const& owner
+    ) {
+        auto traceName               = fmt::format("{} @ {}", eventName, owner ? owner->getName() : "<legacy>");
+        auto counters                = std::make_shared<ListenerCounters>();
+        counters->eventName          = eventName;
+        counters->scriptEventID      = scriptEventID;
+        counters->dispatch.traceName = TraceRecorder::getInstance().intern(std::move(traceName), "listener");
+        mCounters[handle]            = counters;
+        return counters;
     }
-    void removeListener(std::string const& scriptEventID) {
-        ll::event::EventBus::getInstance().removeListener(mListeners[doHash(scriptEventID)]);
-        mListeners.erase(doHash(scriptEventID));
+    std::shared_ptr<ListenerCounters> getCounters(int handle) {
+        auto iter = mCounters.find(handle);
+        if (iter == mCounters.end()) {
+            return nullptr;
+        }
+        auto counters = iter->second.lock();
+        if (!counters) {
+            mCounters.erase(iter);
+        }
+        return counters;
+    }
+
+    template <typename Channel>
+    int addListener(
+        int                          handle,
+        std::string const&           eventName,
+        Channel&                     channel,
+        typename Channel::Subscriber subscriber,
+        typename Channel::Converter  converter
+    ) {
+        if (!channel.subscribe(eventName, std::move(subscriber), converter)) {
+            return -1;
+        }
+        mListeners[handle] = &channel;
+        return handle;
+    }
+    void setOwner(int handle, std::shared_ptr<ll::mod::Mod> const& owner) {
+        attach();
+        mOwners[handle] = owner;
+    }
+    template <typename Fn>
+    void forEachCounters(Fn&& fn) {
+        std::erase_if(mCounters, [](auto const& entry) { return entry.second.expired(); });
+        for (auto& [handle, weak] : mCounters) {
+            fn(handle, *weak.lock());
+        }
+    }
+
+    DeferredQueueStats const* getQueueStats(int handle) const {
+        auto iter = mListeners.find(handle);
+        return iter == mListeners.end() ? nullptr : iter->second->getQueueStats(handle);
+    }
+    bool removeListener(int handle) {
+        mOwners.erase(handle);
+        auto iter = mListeners.find(handle);
+        if (iter == mListeners.end()) {
+            return LandPresenceBatcher::getInstance().remove(handle);
+        }
+        auto removed = iter->second->unsubscribe(handle);
+        mListeners.erase(iter);
+        return removed;
     }
 
 public:
@@ -72,285 +180,541 @@ class ScriptEventManager {
     }
 };
 
-template <typename T>
-void tryCancel(T& ev) {
-    if constexpr (requires { ev.cancel(); }) {
-        ev.cancel();
-    }
-}
-
+// 每个事件类型只有一个原生监听器 (EventChannel)，脚本回调在注册时解析一次
+// 参数在首个需要投递的订阅者处转换一次，之后分发给所有订阅者
+// 不携带领地信息的事件无法过滤，指定过滤器时注册失败
 #define REGISTER_LISTENER(className, importFunc, ...)                                                                  \
-    eventManager->addListener(                                                                                         \
-        scriptEventID,                                                                                                 \
-        bus->emplaceListener<className>([eventName, scriptEventID, eventManager](className& ev) {                      \
-            if (!RemoteCall::hasFunc(eventName, scriptEventID)) {                                                      \
-                eventManager->removeListener(scriptEventID);                                                           \
-                return;                                                                                                \
-            }                                                                                                          \
-            bool result = true;                                                                                        \
-            try {                                                                                                      \
-                result = RemoteCall::importAs<bool importFunc>(eventName, scriptEventID)(__VA_ARGS__);                 \
-            } catch (...) {}                                                                                           \
-            if (!result) {                                                                                             \
-                tryCancel(ev);                                                                                         \
+    {                                                                                                                  \
+        using Channel = EventChannel<className, bool importFunc>;                                                      \
+        if constexpr (!EventHasLand<className>) {                                                                      \
+            if (options.filter) {                                                                                      \
+                return -1;                                                                                             \
             }                                                                                                          \
-        })                                                                                                             \
-    );                                                                                                                 \
-    return true;
+        }                                                                                                              \
+        return eventManager->addListener(                                                                              \
+            handle,                                                                                                    \
+            eventName,                                                                                                 \
+            Channel::getInstance(),                                                                                    \
+            Channel::Subscriber{                                                                                       \
+                handle,                                                                                                \
+                std::move(guard),                                                                                      \
+                options.filter,                                                                                        \
+                options.deferred,                                                                                      \
+                std::move(counters),                                                                                   \
+                RemoteCall::importAs<bool importFunc>(eventName, scriptEventID)                                        \
+            },                                                                                                         \
+            [](className& ev) { return Channel::Arguments(__VA_ARGS__); }                                              \
+        );                                                                                                             \
+    }
 
 
-void Export_LDEvents() {
-    auto* bus          = &ll::event::EventBus::getInstance();
-    auto* eventManager = &ScriptEventManager::getInstance();
+static nlohmann::json dumpDispatchStats(DispatchStats const& stats) {
+    return {
+        {"invocations", stats.invocations.load(std::memory_order_relaxed)},
+        {"cancels",     stats.cancels.load(std::memory_order_relaxed)    },
+        {"exceptions",  stats.exceptions.load(std::memory_order_relaxed) },
+        {"p50Ns",       stats.latency.percentile(0.50)                   },
+        {"p99Ns",       stats.latency.percentile(0.99)                   },
+        {"maxNs",       stats.latency.max()                              }
+    };
+}
 
-    exportAs("ScriptEventManager_genListenerID", [eventManager]() -> std::string {
-        return eventManager->genListenerID();
+nlohmann::json collectEventStats() {
+    auto events = nlohmann::json::object();
+    for (auto& [name, stats] : EventStatsRegistry::getInstance().getAll()) {
+        events[name] = dumpDispatchStats(*stats);
+    }
+
+    auto listeners = nlohmann::json::array();
+    ScriptEventManager::getInstance().forEachCounters([&](int handle, ListenerCounters const& counters) {
+        auto entry         = dumpDispatchStats(counters.dispatch);
+        entry["handle"]    = handle;
+        entry["event"]     = counters.eventName;
+        entry["id"]        = counters.scriptEventID;
+        entry["delivered"] = counters.delivered;
+        entry["skipped"]   = counters.skipped;
+        listeners.push_back(std::move(entry));
+    });
+    return {
+        {"events",    std::move(events)   },
+        {"listeners", std::move(listeners)}
+    };
+}
+
+void resetEventStats() {
+    for (auto& [name, stats] : EventStatsRegistry::getInstance().getAll()) {
+        stats->reset();
+    }
+    ScriptEventManager::getInstance().forEachCounters([](int, ListenerCounters& counters) {
+        counters.dispatch.reset();
     });
+}
 
-    exportAs(
-        "Event_RegisterListener",
-        [bus, eventManager](std::string const& eventName, std::string const& scriptEventID) -> bool {
-            if (!RemoteCall::hasFunc(eventName, scriptEventID)) {
+
+bool EventFilter::matches(land::Land const& land) const {
+    if (!lands.empty() && !lands.contains(land.getId())) {
+        return false;
+    }
+    if (dimid && land.getDimensionId() != *dimid) {
+        return false;
+    }
+    if (owner && land.getOwner() != *owner) {
+        return false;
+    }
+    if (landType && static_cast<int>(land.getType()) != *landType) {
+        return false;
+    }
+    return true;
+}
+
+static bool parseEventFilter(nlohmann::json const& j, EventFilter& out) {
+    if (!j.is_object()) {
+        return false;
+    }
+    if (j.contains("lands")) {
+        if (!j["lands"].is_array()) {
+            return false;
+        }
+        for (auto& id : j["lands"]) {
+            if (!id.is_number_integer()) {
                 return false;
             }
+            out.lands.insert(id.get<land::LandID>());
+        }
+    }
+    if (j.contains("dimid")) {
+        if (!j["dimid"].is_number_integer()) {
+            return false;
+        }
+        out.dimid = j["dimid"].get<land::LandDimid>();
+    }
+    if (j.contains("owner")) {
+        auto owner = j["owner"].is_string() ? parseUUID(j["owner"].get_ref<std::string const&>()) : std::nullopt;
+        if (!owner) {
+            return false;
+        }
+        out.owner = *owner;
+    }
+    if (j.contains("landType")) {
+        if (!j["landType"].is_number_integer()) {
+            return false;
+        }
+        out.landType = j["landType"].get<int>();
+    }
+    return true;
+}
 
-            switch (doHash(eventName)) {
-            case doHash("LandResizedEvent"): {
-                REGISTER_LISTENER(
-                    land::event::LandResizedEvent,
-                    (int, IntPos, IntPos),
-                    ev.land()->getId(),
-                    IntPos{ev.newRange().min.as<>(), ev.land()->getDimensionId()},
-                    IntPos{ev.newRange().max.as<>(), ev.land()->getParentLandID()}
-                )
-            }
-            case doHash("MemberChangedEvent"): {
-                REGISTER_LISTENER(
-                    land::event::MemberChangedEvent,
-                    (int, std::string, bool),
-                    ev.land()->getId(),
-                    ev.target().asString(),
-                    ev.isAdd()
-                )
-            }
-            case doHash("OwnerChangedEvent"): {
-                REGISTER_LISTENER(
-                    land::event::OwnerChangedEvent,
-                    (int, std::string, std::string),
-                    ev.land()->getId(),
-                    ev.oldOwner().asString(),
-                    ev.newOwner().asString()
-                )
-            }
-            case doHash("LandRefundFailedEvent"): {
-                REGISTER_LISTENER(
-                    land::event::LandRefundFailedEvent,
-                    (int, std::string, int),
-                    ev.land()->getId(),
-                    ev.targetPlayer().asString(),
-                    ev.refundAmount()
-                )
-            }
+static bool parseListenerOptions(std::string const& json, ListenerOptions& out) {
+    auto opts = nlohmann::json::parse(json, nullptr, false);
+    if (!opts.is_object() || !opts.contains("owner") || !opts["owner"].is_string()) {
+        return false;
+    }
+    out.owner = ll::mod::ModManagerRegistry::getInstance().getMod(opts["owner"].get<std::string>());
+    if (!out.owner) {
+        return false;
+    }
 
-            case doHash("PlayerApplyLandRangeChangeBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerApplyLandRangeChangeBeforeEvent,
-                    (Player*, int, IntPos, IntPos, std::string, int, int),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    IntPos{ev.newRange().min.as<>(), ev.land()->getDimensionId()},
-                    IntPos{ev.newRange().max.as<>(), ev.land()->getDimensionId()},
-                    magic_enum::enum_name(ev.resizeSettlement().type).data(),
-                    ev.resizeSettlement().newTotalPrice,
-                    ev.resizeSettlement().amount
-                )
-            }
-            case doHash("PlayerApplyLandRangeChangeAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerApplyLandRangeChangeAfterEvent,
-                    (Player*, int, IntPos, IntPos, std::string, int, int),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    IntPos{ev.newRange().min.as<>(), ev.land()->getDimensionId()},
-                    IntPos{ev.newRange().max.as<>(), ev.land()->getDimensionId()},
-                    magic_enum::enum_name(ev.resizeSettlement().type).data(),
-                    ev.resizeSettlement().newTotalPrice,
-                    ev.resizeSettlement().amount
-                )
-            }
+    if (opts.contains("batch")) {
+        auto& batch = opts["batch"];
+        if (!batch.is_object() || (batch.contains("intervalMs") && !batch["intervalMs"].is_number_integer())) {
+            return false;
+        }
+        out.batch         = true;
+        out.batchInterval = std::chrono::milliseconds{std::max(batch.value("intervalMs", 0), 0)};
+    }
 
-            case doHash("PlayerBuyLandBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerBuyLandBeforeEvent,
-                    (Player*, int, std::string),
-                    &ev.self(),
-                    ev.payMoney(),
-                    magic_enum::enum_name(ev.landType()).data()
-                )
-            }
-            case doHash("PlayerBuyLandAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerBuyLandAfterEvent,
-                    (Player*, int, int),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.payMoney()
-                )
-            }
+    if (opts.contains("filter")) {
+        EventFilter filter;
+        if (!parseEventFilter(opts["filter"], filter)) {
+            return false;
+        }
+        out.filter = std::move(filter);
+    }
 
-            case doHash("PlayerChangeLandMemberBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerChangeLandMemberBeforeEvent,
-                    (Player*, int, std::string, bool),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.target().asString(),
-                    ev.isAdd()
-                )
-            }
-            case doHash("PlayerChangeLandMemberAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerChangeLandMemberAfterEvent,
-                    (Player*, int, std::string, bool),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.target().asString(),
-                    ev.isAdd()
-                )
-            }
+    if (opts.contains("deferred")) {
+        auto& deferred = opts["deferred"];
+        if (!deferred.is_object() || (deferred.contains("policy") && !deferred["policy"].is_string())
+            || (deferred.contains("capacity") && !deferred["capacity"].is_number_integer())) {
+            return false;
+        }
+        DeferredOptions result;
+        switch (doHash(deferred.value("policy", std::string{"dropOldest"}))) {
+        case doHash("dropOldest"):
+            result.policy = OverflowPolicy::DropOldest;
+            break;
+        case doHash("block"):
+            result.policy = OverflowPolicy::Block;
+            break;
+        case doHash("coalesce"):
+            result.policy = OverflowPolicy::Coalesce;
+            break;
+        default:
+            return false;
+        }
+        result.capacity = static_cast<size_t>(std::max(deferred.value("capacity", 1024), 1));
+        out.deferred    = result;
+    }
 
-            case doHash("PlayerChangeLandNameBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerChangeLandNameBeforeEvent,
-                    (Player*, int, std::string),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.newName()
-                )
-            }
-            case doHash("PlayerChangeLandNameAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerChangeLandNameAfterEvent,
-                    (Player*, int, std::string),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.newName()
-                )
-            }
+    // 批量投递自带排队，不能再叠加延迟队列
+    return !(out.batch && out.deferred);
+}
 
-            case doHash("PlayerDeleteLandBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerDeleteLandBeforeEvent,
-                    (Player*, int),
-                    &ev.self(),
-                    ev.land()->getId()
-                )
-            }
-            case doHash("PlayerDeleteLandAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerDeleteLandAfterEvent,
-                    (Player*, int),
-                    &ev.self(),
-                    ev.land()->getId()
-                )
-            }
+/**
+ * 注册脚本监听器
+ * @param options.owner 导出回调的脚本模组，为空时退化为每次派发前检查 hasFunc；不为空时由调用方登记 (setOwner)
+ * @return 监听器句柄，失败返回 -1
+ */
+static int registerScriptListener(
+    std::string const&     eventName,
+    std::string const&     scriptEventID,
+    ListenerOptions const& options
+) {
+    auto* eventManager = &ScriptEventManager::getInstance();
 
-            case doHash("PlayerEnterLandEvent"): {
-                REGISTER_LISTENER(land::event::PlayerEnterLandEvent, (Player*, int), &ev.self(), ev.landId())
-            }
-            case doHash("PlayerLeaveLandEvent"): {
-                REGISTER_LISTENER(land::event::PlayerLeaveLandEvent, (Player*, int), &ev.self(), ev.landId())
-            }
+    if (!RemoteCall::hasFunc(eventName, scriptEventID)) {
+        return -1;
+    }
 
-            case doHash("PlayerRequestChangeLandRangeBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerRequestChangeLandRangeBeforeEvent,
-                    (Player*, int),
-                    &ev.self(),
-                    ev.land()->getId()
-                )
-            }
-            case doHash("PlayerRequestChangeLandRangeAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerRequestChangeLandRangeAfterEvent,
-                    (Player*, int),
-                    &ev.self(),
-                    ev.land()->getId()
-                )
-            }
+    std::optional<ScriptCallbackGuard> guard;
+    if (!options.owner) {
+        guard.emplace(eventName, scriptEventID);
+    }
+    auto handle   = eventManager->nextHandle();
+    auto counters = eventManager->createCounters(handle, eventName, scriptEventID, options.owner);
+
+    if (options.batch) {
+        // 批量模式同时投递进入与离开记录，注册在两者任一名称下均可
+        auto hash = doHash(eventName);
+        if (hash != doHash("PlayerEnterLandEvent") && hash != doHash("PlayerLeaveLandEvent")) {
+            return -1;
+        }
+        LandPresenceBatcher::getInstance().add(
+            handle,
+            RemoteCall::importAs<bool(std::vector<std::string>, std::vector<land::LandID>, std::vector<int>)>(
+                eventName,
+                scriptEventID
+            ),
+            options.batchInterval,
+            options.filter,
+            std::move(counters)
+        );
+        return handle;
+    }
 
-            case doHash("PlayerRequestCreateLandEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerRequestCreateLandEvent,
-                    (Player*, std::string),
-                    &ev.self(),
-                    magic_enum::enum_name(ev.type()).data()
-                )
-            }
+    switch (doHash(eventName)) {
+    case doHash("LandResizedEvent"): {
+        REGISTER_LISTENER(
+            land::event::LandResizedEvent,
+            (int, IntPos, IntPos),
+            ev.land()->getId(),
+            IntPos{ev.newRange().min.as<>(), ev.land()->getDimensionId()},
+            IntPos{ev.newRange().max.as<>(), ev.land()->getParentLandID()}
+        )
+    }
+    case doHash("MemberChangedEvent"): {
+        REGISTER_LISTENER(
+            land::event::MemberChangedEvent,
+            (int, std::string, bool),
+            ev.land()->getId(),
+            formatUUID(ev.target()),
+            ev.isAdd()
+        )
+    }
+    case doHash("OwnerChangedEvent"): {
+        REGISTER_LISTENER(
+            land::event::OwnerChangedEvent,
+            (int, std::string, std::string),
+            ev.land()->getId(),
+            formatUUID(ev.oldOwner()),
+            formatUUID(ev.newOwner())
+        )
+    }
+    case doHash("LandRefundFailedEvent"): {
+        REGISTER_LISTENER(
+            land::event::LandRefundFailedEvent,
+            (int, std::string, int),
+            ev.land()->getId(),
+            formatUUID(ev.targetPlayer()),
+            ev.refundAmount()
+        )
+    }
 
-            case doHash("PlayerTransferLandBeforeEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerTransferLandBeforeEvent,
-                    (Player*, int, std::string),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.newOwner().asString()
-                )
-            }
-            case doHash("PlayerTransferLandAfterEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerTransferLandAfterEvent,
-                    (Player*, int, std::string),
-                    &ev.self(),
-                    ev.land()->getId(),
-                    ev.newOwner().asString()
-                )
-            }
+    case doHash("PlayerApplyLandRangeChangeBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerApplyLandRangeChangeBeforeEvent,
+            (Player*, int, IntPos, IntPos, std::string, int, int),
+            &ev.self(),
+            ev.land()->getId(),
+            IntPos{ev.newRange().min.as<>(), ev.land()->getDimensionId()},
+            IntPos{ev.newRange().max.as<>(), ev.land()->getDimensionId()},
+            magic_enum::enum_name(ev.resizeSettlement().type).data(),
+            ev.resizeSettlement().newTotalPrice,
+            ev.resizeSettlement().amount
+        )
+    }
+    case doHash("PlayerApplyLandRangeChangeAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerApplyLandRangeChangeAfterEvent,
+            (Player*, int, IntPos, IntPos, std::string, int, int),
+            &ev.self(),
+            ev.land()->getId(),
+            IntPos{ev.newRange().min.as<>(), ev.land()->getDimensionId()},
+            IntPos{ev.newRange().max.as<>(), ev.land()->getDimensionId()},
+            magic_enum::enum_name(ev.resizeSettlement().type).data(),
+            ev.resizeSettlement().newTotalPrice,
+            ev.resizeSettlement().amount
+        )
+    }
 
-            case doHash("LandRecycleEvent"): {
-                REGISTER_LISTENER(
-                    land::event::LandRecycleEvent,
-                    (int, int),
-                    ev.land()->getId(),
-                    static_cast<int>(ev.reason())
-                );
-            }
-            case doHash("LandStateChangedEvent"): {
-                REGISTER_LISTENER(
-                    land::event::LandStateChangedEvent,
-                    (int, int, int),
-                    ev.land()->getId(),
-                    static_cast<int>(ev.oldState()),
-                    static_cast<int>(ev.newState())
-                );
-            }
-            case doHash("MembersClearedEvent"): {
-                REGISTER_LISTENER(land::event::MembersClearedEvent, (int), ev.land()->getId());
-            }
-            case doHash("PlayerLeaseLandEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerLeaseLandEvent,
-                    (int, int, int),
-                    ev.land()->getId(),
-                    ev.payMoney(),
-                    ev.days()
-                );
-            }
-            case doHash("PlayerRenewLandEvent"): {
-                REGISTER_LISTENER(
-                    land::event::PlayerRenewLandEvent,
-                    (int, int, int),
-                    ev.land()->getId(),
-                    ev.payMoney(),
-                    ev.days()
-                );
-            }
+    case doHash("PlayerBuyLandBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerBuyLandBeforeEvent,
+            (Player*, int, std::string),
+            &ev.self(),
+            ev.payMoney(),
+            magic_enum::enum_name(ev.landType()).data()
+        )
+    }
+    case doHash("PlayerBuyLandAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerBuyLandAfterEvent,
+            (Player*, int, int),
+            &ev.self(),
+            ev.land()->getId(),
+            ev.payMoney()
+        )
+    }
 
-            default:
-                return false;
+    case doHash("PlayerChangeLandMemberBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerChangeLandMemberBeforeEvent,
+            (Player*, int, std::string, bool),
+            &ev.self(),
+            ev.land()->getId(),
+            formatUUID(ev.target()),
+            ev.isAdd()
+        )
+    }
+    case doHash("PlayerChangeLandMemberAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerChangeLandMemberAfterEvent,
+            (Player*, int, std::string, bool),
+            &ev.self(),
+            ev.land()->getId(),
+            formatUUID(ev.target()),
+            ev.isAdd()
+        )
+    }
+
+    case doHash("PlayerChangeLandNameBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerChangeLandNameBeforeEvent,
+            (Player*, int, std::string),
+            &ev.self(),
+            ev.land()->getId(),
+            ev.newName()
+        )
+    }
+    case doHash("PlayerChangeLandNameAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerChangeLandNameAfterEvent,
+            (Player*, int, std::string),
+            &ev.self(),
+            ev.land()->getId(),
+            ev.newName()
+        )
+    }
+
+    case doHash("PlayerDeleteLandBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerDeleteLandBeforeEvent,
+            (Player*, int),
+            &ev.self(),
+            ev.land()->getId()
+        )
+    }
+    case doHash("PlayerDeleteLandAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerDeleteLandAfterEvent,
+            (Player*, int),
+            &ev.self(),
+            ev.land()->getId()
+        )
+    }
+
+    case doHash("PlayerEnterLandEvent"): {
+        REGISTER_LISTENER(land::event::PlayerEnterLandEvent, (Player*, int), &ev.self(), ev.landId())
+    }
+    case doHash("PlayerLeaveLandEvent"): {
+        REGISTER_LISTENER(land::event::PlayerLeaveLandEvent, (Player*, int), &ev.self(), ev.landId())
+    }
+
+    case doHash("PlayerRequestChangeLandRangeBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerRequestChangeLandRangeBeforeEvent,
+            (Player*, int),
+            &ev.self(),
+            ev.land()->getId()
+        )
+    }
+    case doHash("PlayerRequestChangeLandRangeAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerRequestChangeLandRangeAfterEvent,
+            (Player*, int),
+            &ev.self(),
+            ev.land()->getId()
+        )
+    }
+
+    case doHash("PlayerRequestCreateLandEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerRequestCreateLandEvent,
+            (Player*, std::string),
+            &ev.self(),
+            magic_enum::enum_name(ev.type()).data()
+        )
+    }
+
+    case doHash("PlayerTransferLandBeforeEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerTransferLandBeforeEvent,
+            (Player*, int, std::string),
+            &ev.self(),
+            ev.land()->getId(),
+            formatUUID(ev.newOwner())
+        )
+    }
+    case doHash("PlayerTransferLandAfterEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerTransferLandAfterEvent,
+            (Player*, int, std::string),
+            &ev.self(),
+            ev.land()->getId(),
+            formatUUID(ev.newOwner())
+        )
+    }
+
+    case doHash("LandRecycleEvent"): {
+        REGISTER_LISTENER(
+            land::event::LandRecycleEvent,
+            (int, int),
+            ev.land()->getId(),
+            static_cast<int>(ev.reason())
+        );
+    }
+    case doHash("LandStateChangedEvent"): {
+        REGISTER_LISTENER(
+            land::event::LandStateChangedEvent,
+            (int, int, int),
+            ev.land()->getId(),
+            static_cast<int>(ev.oldState()),
+            static_cast<int>(ev.newState())
+        );
+    }
+    case doHash("MembersClearedEvent"): {
+        REGISTER_LISTENER(land::event::MembersClearedEvent, (int), ev.land()->getId());
+    }
+    case doHash("PlayerLeaseLandEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerLeaseLandEvent,
+            (int, int, int),
+            ev.land()->getId(),
+            ev.payMoney(),
+            ev.days()
+        );
+    }
+    case doHash("PlayerRenewLandEvent"): {
+        REGISTER_LISTENER(
+            land::event::PlayerRenewLandEvent,
+            (int, int, int),
+            ev.land()->getId(),
+            ev.payMoney(),
+            ev.days()
+        );
+    }
+
+    default:
+        return -1;
+    }
+}
+
+
+void Export_LDEvents() {
+    auto* eventManager = &ScriptEventManager::getInstance();
+
+    exportAs("ScriptEventManager_genListenerID", [eventManager]() -> std::string {
+        return eventManager->genListenerID();
+    });
+
+    // 旧式注册，不知道所属脚本，每次派发前都要 hasFunc；LDEvent.listen 已改为经 Event_RegisterListenerEx 注册
+    exportAs("Event_RegisterListener", [](std::string const& eventName, std::string const& scriptEventID) -> bool {
+        return registerScriptListener(eventName, scriptEventID, {}) != -1;
+    });
+
+    // options: 见 ListenerOptions；所属脚本卸载或禁用后，其监听器在下一 tick 统一移除
+    exportAs(
+        "Event_RegisterListenerEx",
+        [eventManager](
+            std::string const& eventName,
+            std::string const& scriptEventID,
+            std::string const& options
+        ) -> int {
+            ListenerOptions opts;
+            if (!parseListenerOptions(options, opts)) {
+                return -1;
+            }
+            auto handle = registerScriptListener(eventName, scriptEventID, opts);
+            if (handle != -1) {
+                eventManager->setOwner(handle, opts.owner);
             }
+            return handle;
         }
     );
+
+    exportAs("Event_RemoveListener", [eventManager](int handle) -> bool {
+        return eventManager->removeListener(handle);
+    });
+
+    // 派发统计 (JSON)，格式见 collectEventStats
+    exportAs("Event_getStats", []() -> std::string { return collectEventStats().dump(); });
+
+    exportAs("Event_resetStats", []() -> void { resetEventStats(); });
+
+    // [depth, maxDepth, capacity, enqueued, delivered, dropped, coalesced, blocked]
+    // handle 为 -1 时返回所有延迟队列之和，句柄无效或不是延迟投递时为空
+    exportAs("Event_getQueueStats", [eventManager](int handle) -> std::vector<int64_t> {
+        auto toList = [](DeferredQueueStats const& stats) -> std::vector<int64_t> {
+            return {
+                static_cast<int64_t>(stats.depth),
+                static_cast<int64_t>(stats.maxDepth),
+                static_cast<int64_t>(stats.capacity),
+                static_cast<int64_t>(stats.enqueued),
+                static_cast<int64_t>(stats.delivered),
+                static_cast<int64_t>(stats.dropped),
+                static_cast<int64_t>(stats.coalesced),
+                static_cast<int64_t>(stats.blocked)
+            };
+        };
+        if (handle == -1) {
+            return toList(DeferredDispatcher::getInstance().getTotalStats());
+        }
+        auto stats = eventManager->getQueueStats(handle);
+        return stats ? toList(*stats) : std::vector<int64_t>{};
+    });
+
+    // 每 tick 投递延迟事件的时间预算 (微秒)
+    exportAs("Event_setDeferredBudget", [](int microseconds) -> void {
+        DeferredDispatcher::getInstance().setBudget(std::chrono::microseconds{std::max(microseconds, 0)});
+    });
+
+    // [delivered, skipped]，句柄无效时为空
+    exportAs("Event_getListenerStats", [eventManager](int handle) -> std::vector<int64_t> {
+        auto counters = eventManager->getCounters(handle);
+        if (!counters) {
+            return {};
+        }
+        return {static_cast<int64_t>(counters->delivered), static_cast<int64_t>(counters->skipped)};
+    });
 }
 
 
@@ -0,0 +1,120 @@
+#pragma once
+#include "ll/api/mod/Mod.h"
+
+#include "mc/platform/UUID.h"
+
+#include "nlohmann/json.hpp"
+
+#include "pland/Global.h"
+#include "pland/PLand.h"
+#include "pland/land/Land.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+#include "exports/DeferredQueue.h"
+#include "exports/EventStats.h"
+
+#include "ExportDef.h"
+
+
+namespace ldapi {
+
+
+/**
+ * 旧式注册 (不知道所属脚本) 的存活检查，派发前通过 hasFunc 确认导出函数仍然存在
+ * 指定了所属脚本的监听器不做检查，脚本模组卸载 / 禁用后由 ScriptEventManager 统一移除
+ */
+class ScriptCallbackGuard {
+public:
+    ScriptCallbackGuard(std::string eventName, std::string scriptEventID)
+    : mEventName(std::move(eventName)),
+      mScriptEventID(std::move(scriptEventID)) {}
+
+    [[nodiscard]] bool isAlive() const { return RemoteCall::hasFunc(mEventName, mScriptEventID); }
+
+private:
+    std::string mEventName;
+    std::string mScriptEventID;
+};
+
+
+/**
+ * 原生侧事件过滤器，不匹配的事件不会跨入脚本引擎
+ * 各条件之间为 "与" 关系，未设置的条件不做限制
+ */
+struct EventFilter {
+    std::unordered_set<land::LandID> lands;    // 领地 ID 集合
+    std::optional<land::LandDimid>   dimid;    // 维度
+    std::optional<mce::UUID>         owner;    // 领地主人
+    std::optional<int>               landType; // land::LandType
+
+    [[nodiscard]] bool matches(land::Land const& land) const;
+};
+
+/**
+ * 单个监听器的投递统计
+ */
+struct ListenerCounters {
+    std::string   eventName;
+    std::string   scriptEventID;
+    uint64_t      delivered{0}; // 调用脚本回调的次数 (批量模式为记录条数)
+    uint64_t      skipped{0};   // 被过滤器拒绝的次数
+    DispatchStats dispatch;     // 回调耗时 / 拦截 / 异常
+};
+
+/**
+ * Event_RegisterListenerEx 的注册选项
+ * {
+ *   "owner": "<脚本插件名>",
+ *   "batch": { "intervalMs": 0 },
+ *   "filter": { "lands": [1, 2], "dimid": 0, "owner": "<uuid>", "landType": 0 },
+ *   "deferred": { "policy": "dropOldest" | "block" | "coalesce", "capacity": 1024 }
+ * }
+ * batch 与 deferred 不能同时指定，字段类型不符时注册失败
+ */
+struct ListenerOptions {
+    std::shared_ptr<ll::mod::Mod>  owner;            // 导出回调的脚本模组
+    bool                           batch{false};     // 批量投递 (仅 PlayerEnterLandEvent / PlayerLeaveLandEvent)
+    std::chrono::milliseconds      batchInterval{0}; // 批量投递间隔，0 表示每 tick
+    std::optional<EventFilter>     filter;           // 仅对携带领地信息的事件有效
+    std::optional<DeferredOptions> deferred;         // 延迟投递 (仅不可拦截的事件)
+};
+
+
+/**
+ * 派发统计快照
+ * {
+ *   "events":    { "<事件名>": { invocations, cancels, exceptions, p50Ns, p99Ns, maxNs } },
+ *   "listeners": [ { handle, event, id, delivered, skipped, invocations, cancels, exceptions, p50Ns, p99Ns, maxNs } ]
+ * }
+ */
+nlohmann::json collectEventStats();
+
+/// 清空所有派发统计
+void resetEventStats();
+
+
+/// 事件是否携带领地信息 (land() 或 landId())
+template <typename E>
+constexpr bool EventHasLand = requires(E const& ev) { ev.land(); } || requires(E const& ev) { ev.landId(); };
+
+/// 获取事件关联的领地
+template <typename E>
+land::SharedLand getEventLand(E const& ev) {
+    if constexpr (requires { ev.land(); }) {
+        return ev.land();
+    } else if constexpr (requires { ev.landId(); }) {
+        return land::PLand::getInstance().getLandRegistry().getLand(ev.landId());
+    } else {
+        return nullptr;
+    }
+}
+
+
+} // namespace ldapi
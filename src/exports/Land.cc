@@ -5,88 +5,317 @@
 #include "pland/land/repo/LandRegistry.h"
 #include "pland/utils/JsonUtil.h"
 
+#include "ll/api/utils/HashUtils.h"
+
 #include "mc/platform/UUID.h"
 
 #include <algorithm>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "ExportDef.h"
 #include "exports/APIHelper.h"
+#include "exports/LandHandles.h"
+#include "exports/LandObserver.h"
+#include "exports/PermCache.h"
+#include "exports/PermFields.h"
+#include "exports/UUIDCache.h"
 
 
 namespace ldapi {
 
+using ll::hash_utils::doHash;
+
+
+// 快照字段掩码，与 ts/imports/Land.ts 中的 LandSnapshotField 保持一致
+enum class LandSnapshotField : int {
+    Name             = 1 << 0,
+    Owner            = 1 << 1,
+    DimensionId      = 1 << 2,
+    AABB             = 1 << 3,
+    TeleportPos      = 1 << 4,
+    Members          = 1 << 5,
+    Type             = 1 << 6,
+    HoldType         = 1 << 7,
+    LeaseState       = 1 << 8,
+    LeaseStartAt     = 1 << 9,
+    LeaseEndAt       = 1 << 10,
+    OriginalBuyPrice = 1 << 11,
+    Is3D             = 1 << 12,
+    ParentLandID     = 1 << 13,
+    SubLandIDs       = 1 << 14,
+    NestedLevel      = 1 << 15,
+    PermTable        = 1 << 16,
+};
+
+static nlohmann::json makeLandSnapshot(land::Land const& land, int fieldMask) {
+    auto has = [fieldMask](LandSnapshotField field) { return (fieldMask & static_cast<int>(field)) != 0; };
+
+    auto j  = nlohmann::json::object();
+    j["id"] = land.getId();
+    if (has(LandSnapshotField::Name)) j["name"] = land.getName();
+    if (has(LandSnapshotField::Owner)) j["owner"] = formatUUID(land.getOwner());
+    // 坐标类字段依赖维度 ID 构造 IntPos，因此总是附带 dimid
+    if (has(LandSnapshotField::DimensionId) || has(LandSnapshotField::AABB) || has(LandSnapshotField::TeleportPos)) {
+        j["dimid"] = land.getDimensionId();
+    }
+    if (has(LandSnapshotField::AABB)) {
+        auto& aabb = land.getAABB();
+        j["aabb"]  = {aabb.min.x, aabb.min.y, aabb.min.z, aabb.max.x, aabb.max.y, aabb.max.z};
+    }
+    if (has(LandSnapshotField::TeleportPos)) {
+        auto& pos        = land.getTeleportPos();
+        j["teleportPos"] = {pos.x, pos.y, pos.z};
+    }
+    if (has(LandSnapshotField::Members)) {
+        auto members = nlohmann::json::array();
+        for (auto& member : land.getMembers()) {
+            members.push_back(formatUUID(member));
+        }
+        j["members"] = std::move(members);
+    }
+    if (has(LandSnapshotField::Type)) j["type"] = static_cast<int>(land.getType());
+    if (has(LandSnapshotField::HoldType)) j["holdType"] = static_cast<int>(land.getHoldType());
+    if (has(LandSnapshotField::LeaseState)) j["leaseState"] = static_cast<int>(land.getLeaseState());
+    if (has(LandSnapshotField::LeaseStartAt)) j["leaseStartAt"] = std::to_string(land.getLeaseStartAt());
+    if (has(LandSnapshotField::LeaseEndAt)) j["leaseEndAt"] = std::to_string(land.getLeaseEndAt());
+    if (has(LandSnapshotField::OriginalBuyPrice)) j["originalBuyPrice"] = land.getOriginalBuyPrice();
+    if (has(LandSnapshotField::Is3D)) j["is3D"] = land.is3D();
+    if (has(LandSnapshotField::ParentLandID)) j["parentLandID"] = land.getParentLandID();
+    if (has(LandSnapshotField::SubLandIDs)) j["subLandIDs"] = land.getSubLandIDs();
+    if (has(LandSnapshotField::NestedLevel)) j["nestedLevel"] = land.getNestedLevel();
+    if (has(LandSnapshotField::PermTable)) j["permTable"] = Converter<land::LandPermTable>::toJson(land.getPermTable());
+    return j;
+}
+
+
+// 批量修改操作，与 ts/imports/Land.ts 中的 LandBatchOp 保持一致
+enum class LandBatchOpType { SetOwner, SetName, SetPermTable, AddMember, RemoveMember, SetOriginalBuyPrice };
+
+struct LandBatchOp {
+    LandBatchOpType     type;
+    land::SharedLand    land;
+    mce::UUID           uuid{};
+    std::string         name{};
+    land::LandPermTable permTable{};
+    int                 price{0};
+};
+
+// 预检单个操作，失败时返回错误信息
+static std::optional<std::string> prepareLandBatchOp(nlohmann::json const& j, LandBatchOp& out) {
+    if (!j.is_object() || !j.contains("op") || !j["op"].is_string() || !j.contains("id")
+        || !j["id"].is_number_integer()) {
+        return "malformed operation";
+    }
+    auto id  = j["id"].get<LandRef>();
+    out.land = resolveLand(id);
+    if (!out.land) {
+        return fmt::format("land [{}] not found", id);
+    }
+
+    auto& op    = j["op"].get_ref<std::string const&>();
+    auto  value = j.value("value", nlohmann::json{});
+
+    auto readUUID = [&]() -> std::optional<std::string> {
+        auto parsed = value.is_string() ? parseUUID(value.get_ref<std::string const&>()) : std::nullopt;
+        if (!parsed) {
+            return fmt::format("{}: invalid uuid", op);
+        }
+        out.uuid = *parsed;
+        return std::nullopt;
+    };
+
+    switch (doHash(op)) {
+    case doHash("setOwner"):
+        out.type = LandBatchOpType::SetOwner;
+        return readUUID();
+    case doHash("addMember"):
+        out.type = LandBatchOpType::AddMember;
+        return readUUID();
+    case doHash("removeMember"):
+        out.type = LandBatchOpType::RemoveMember;
+        return readUUID();
+    case doHash("setName"):
+        if (!value.is_string()) {
+            return "setName: value must be a string";
+        }
+        out.type = LandBatchOpType::SetName;
+        out.name = value.get<std::string>();
+        return std::nullopt;
+    case doHash("setOriginalBuyPrice"):
+        if (!value.is_number_integer()) {
+            return "setOriginalBuyPrice: value must be an integer";
+        }
+        out.type  = LandBatchOpType::SetOriginalBuyPrice;
+        out.price = value.get<int>();
+        return std::nullopt;
+    case doHash("setPermTable"):
+        if (!value.is_object()) {
+            return "setPermTable: value must be an object";
+        }
+        try {
+            out.type      = LandBatchOpType::SetPermTable;
+            out.permTable = Converter<land::LandPermTable>::fromJson(value);
+        } catch (std::exception const& e) {
+            return fmt::format("setPermTable: {}", e.what());
+        }
+        return std::nullopt;
+    default:
+        return fmt::format("unknown operation [{}]", op);
+    }
+}
+
+// 按操作顺序模拟成员变化，重复添加 / 移除不存在的成员在应用前即被拒绝，返回出错的操作下标与错误信息
+static std::optional<std::pair<size_t, std::string>> checkLandBatchMembers(std::vector<LandBatchOp> const& ops) {
+    std::unordered_map<land::LandID, std::unordered_map<mce::UUID, bool>> members; // 模拟后的成员状态
+    for (size_t i = 0; i < ops.size(); ++i) {
+        auto& op = ops[i];
+        if (op.type != LandBatchOpType::AddMember && op.type != LandBatchOpType::RemoveMember) {
+            continue;
+        }
+        auto  id       = op.land->getId();
+        auto& isMember = members[id].try_emplace(op.uuid, op.land->isMember(op.uuid)).first->second;
+        if (op.type == LandBatchOpType::AddMember && isMember) {
+            return std::pair{i, fmt::format("land [{}] already has member [{}]", id, op.uuid.asString())};
+        }
+        if (op.type == LandBatchOpType::RemoveMember && !isMember) {
+            return std::pair{i, fmt::format("land [{}] has no member [{}]", id, op.uuid.asString())};
+        }
+        isMember = op.type == LandBatchOpType::AddMember;
+    }
+    return std::nullopt;
+}
+
+// 成员操作已由 checkLandBatchMembers 预检，这里的失败仅在 PLand 另有拒绝条件时出现
+static nlohmann::json applyLandBatchOp(LandBatchOp const& op) {
+    auto& land = *op.land;
+    switch (op.type) {
+    case LandBatchOpType::SetOwner:
+        land.setOwner(op.uuid);
+        LandObserver::getInstance().notify({land.getId(), LandChangeKind::OwnerChanged});
+        break;
+    case LandBatchOpType::SetName:
+        land.setName(op.name);
+        break;
+    case LandBatchOpType::SetPermTable:
+        land.setPermTable(op.permTable);
+        break;
+    case LandBatchOpType::SetOriginalBuyPrice:
+        land.setOriginalBuyPrice(op.price);
+        break;
+    case LandBatchOpType::AddMember:
+        if (!land.addLandMember(op.uuid)) {
+            return ffi_error_payload(fmt::format("land [{}] rejected member [{}]", land.getId(), op.uuid.asString()));
+        }
+        LandObserver::getInstance().notify({land.getId(), LandChangeKind::MembersChanged});
+        break;
+    case LandBatchOpType::RemoveMember:
+        if (!land.removeLandMember(op.uuid)) {
+            return ffi_error_payload(fmt::format("land [{}] has no member [{}]", land.getId(), op.uuid.asString()));
+        }
+        LandObserver::getInstance().notify({land.getId(), LandChangeKind::MembersChanged});
+        break;
+    }
+    return ffi_success_payload();
+}
+
+
+// Land_checkPerm 的结果
+enum class PermCheckResult : int { Invalid = -1, Deny = 0, Allow = 1, NoLand = 2 };
+
+// 解析坐标处的领地，根据玩家的 LandPermType 直接按偏移读取对应的权限标志
+static PermCheckResult
+checkLandPerm(land::LandRegistry& registry, IntPos const& pos, mce::UUID const& uuid, PermFieldGroup const& group) {
+    auto land = registry.getLandAt(pos.first, pos.second);
+    if (!land) {
+        return PermCheckResult::NoLand;
+    }
+
+    auto& table = land->getPermTable();
+    if (group.flag) {
+        return PermFieldTable::get(table, *group.flag) ? PermCheckResult::Allow : PermCheckResult::Deny;
+    }
+
+    auto type = registry.getPermType(uuid, land->getId(), true);
+    if (type == land::LandPermType::Owner || type == land::LandPermType::Admin) { // Admin: v0.19.x 起 (此前为 Operator)
+        return PermCheckResult::Allow;
+    }
+    auto const& field = type == land::LandPermType::Member ? *group.member : *group.actor;
+    return PermFieldTable::get(table, field) ? PermCheckResult::Allow : PermCheckResult::Deny;
+}
 
 void Export_Class_Land() {
     auto& registry = land::PLand::getInstance().getLandRegistry();
 
-    exportAs("Land_isSystemOwned", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isSystemOwned", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isSystemOwned();
     });
-    exportAs("Land_isBought", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isBought", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isBought();
     });
-    exportAs("Land_isLeased", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isLeased", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isLeased();
     });
-    exportAs("Land_isLeaseActive", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isLeaseActive", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isLeaseActive();
     });
-    exportAs("Land_isLeaseFrozen", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isLeaseFrozen", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isLeaseFrozen();
     });
-    exportAs("Land_isLeaseExpired", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isLeaseExpired", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isLeaseExpired();
     });
-    exportAs("Land_getHoldType", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getHoldType", [](LandRef _landId) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return static_cast<int>(land->getHoldType());
     });
-    exportAs("Land_getLeaseState", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getLeaseState", [](LandRef _landId) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return static_cast<int>(land->getLeaseState());
     });
     // 考虑到时间戳的长度，以及脚本传递安全性，使用 std::string 传输
-    exportAs("Land_getLeaseStartAt", [&registry](int _landId) -> std::string {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getLeaseStartAt", [](LandRef _landId) -> std::string {
+        auto land = resolveLand(_landId);
         if (!land) {
             return "";
         }
         return std::to_string(land->getLeaseStartAt());
     });
-    exportAs("Land_getLeaseEndAt", [&registry](int _landId) -> std::string {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getLeaseEndAt", [](LandRef _landId) -> std::string {
+        auto land = resolveLand(_landId);
         if (!land) {
             return "";
         }
@@ -94,92 +323,198 @@ void Export_Class_Land() {
     });
 
 
-    exportAs("Land_getAABB", [&registry](int _landId) -> InternalLandAABB {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getAABB", [](LandRef _landId) -> InternalLandAABB {
+        auto land = resolveLand(_landId);
         if (!land) {
             return {};
         }
         return toLSE<land::LandAABB>(land->getAABB(), land->getDimensionId());
     });
 
-    exportAs("Land_getTeleportPos", [&registry](int _landId) -> IntPos {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getTeleportPos", [](LandRef _landId) -> IntPos {
+        auto land = resolveLand(_landId);
         if (!land) {
             return {};
         }
         return toLSE<land::LandPos>(land->getTeleportPos(), land->getDimensionId());
     });
 
-    exportAs("Land_setTeleportPos", [&registry](int _landId, IntPos pos) -> void {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_setTeleportPos", [](LandRef _landId, IntPos pos) -> void {
+        auto land = resolveLand(_landId);
         if (!land) {
             return;
         }
         land->setTeleportPos(toCpp<land::LandPos>(pos));
     });
 
-    exportAs("Land_getId", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getId", [](LandRef _landId) -> land::LandID {
+        auto land = resolveLand(_landId);
         if (!land) {
             return land::INVALID_LAND_ID;
         }
         return land->getId();
     });
 
-    exportAs("Land_getDimensionId", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getDimensionId", [](LandRef _landId) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return land::INVALID_LAND_ID;
         }
         return land->getDimensionId();
     });
 
-    exportAs("Land_getPermTable", [&registry](int _landId) -> std::string {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getPermTable", [](LandRef _landId) -> std::string {
+        auto land = resolveLand(_landId);
         if (!land) {
             return "";
         }
-        return toLSE<land::LandPermTable>(land->getPermTable());
+        return PermTableCache::getInstance().getSerialized(*land);
     });
 
-    exportAs("Land_setPermTable", [&registry](int _landId, std::string const& permTable) -> void {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_setPermTable", [](LandRef _landId, std::string const& permTable) -> void {
+        auto land = resolveLand(_landId);
         if (!land) {
             return;
         }
         land->setPermTable(toCpp<land::LandPermTable>(permTable));
     });
 
-    exportAs("Land_getOwner", [&registry](int _landId) -> std::string {
-        auto land = registry.getLand(_landId);
+    // 单个权限标志: 1 允许, 0 禁止, -1 领地不存在或字段无效
+    exportAs("Land_getPerm", [](LandRef _landId, std::string const& field, std::string const& role) -> int {
+        auto land = resolveLand(_landId);
+        if (!land) {
+            return -1;
+        }
+        auto perm = PermFieldTable::getInstance().resolve(field, role);
+        if (!perm) {
+            return -1;
+        }
+        return PermFieldTable::get(land->getPermTable(), *perm) ? 1 : 0;
+    });
+
+    // 批量修改权限标志 (fields / roles / values 一一对应)，全部字段有效时才一次性写回
+    exportFfi(
+        "Land_setPerms",
+        [](
+            LandRef                  _landId,
+            std::vector<std::string> fields,
+            std::vector<std::string> roles,
+            std::vector<int>         values
+        ) -> FfiResult<> {
+            auto land = resolveLand(_landId);
+            if (!land) {
+                return ffi_error("Land_setPerms: land {} not found", _landId);
+            }
+            if (fields.size() != roles.size() || fields.size() != values.size()) {
+                return ffi_error("Land_setPerms: fields, roles and values must have the same length");
+            }
+
+            auto& fieldTable = PermFieldTable::getInstance();
+            auto  table      = land->getPermTable();
+            for (size_t i = 0; i < fields.size(); ++i) {
+                auto perm = fieldTable.resolve(fields[i], roles[i]);
+                if (!perm) {
+                    return ffi_error("Land_setPerms: unknown permission '{}' (role '{}')", fields[i], roles[i]);
+                }
+                PermFieldTable::set(table, *perm, values[i] != 0);
+            }
+            land->setPermTable(table);
+            return {};
+        }
+    );
+
+    // 权限检查: 1 允许, 0 禁止, 2 坐标处无领地, -1 UUID 或字段无效
+    exportAs("Land_checkPerm", [&registry](IntPos pos, std::string const& uuid, std::string const& field) -> int {
+        auto group  = PermFieldTable::getInstance().resolveGroup(field);
+        auto parsed = parseUUID(uuid);
+        if (!group.isValid() || !parsed) {
+            return static_cast<int>(PermCheckResult::Invalid);
+        }
+        return static_cast<int>(checkLandPerm(registry, pos, *parsed, group));
+    });
+
+    // 批量权限检查: positions / uuids / fields 一一对应，结果含义同 Land_checkPerm
+    exportAs(
+        "Land_checkPerms",
+        [&registry](
+            std::vector<IntPos>      positions,
+            std::vector<std::string> uuids,
+            std::vector<std::string> fields
+        ) -> std::vector<int> {
+            if (positions.size() != uuids.size() || positions.size() != fields.size()) {
+                return {};
+            }
+
+            auto& fieldTable = PermFieldTable::getInstance();
+
+            // 同一批次中玩家与字段高度重复，记住上一次的解析结果
+            std::string_view         lastUuid, lastField;
+            std::optional<mce::UUID> parsed;
+            PermFieldGroup           group;
+
+            std::vector<int> result;
+            result.reserve(positions.size());
+            for (size_t i = 0; i < positions.size(); ++i) {
+                if (i == 0 || uuids[i] != lastUuid) {
+                    lastUuid = uuids[i];
+                    parsed   = parseUUID(uuids[i]);
+                }
+                if (i == 0 || fields[i] != lastField) {
+                    lastField = fields[i];
+                    group     = fieldTable.resolveGroup(fields[i]);
+                }
+                if (!parsed || !group.isValid()) {
+                    result.push_back(static_cast<int>(PermCheckResult::Invalid));
+                    continue;
+                }
+                result.push_back(static_cast<int>(checkLandPerm(registry, positions[i], *parsed, group)));
+            }
+            return result;
+        }
+    );
+
+    // [hits, misses, entries]
+    exportAs("Land_getPermCacheStats", []() -> std::vector<int64_t> {
+        auto stats = PermTableCache::getInstance().getStats();
+        return {
+            static_cast<int64_t>(stats.hits),
+            static_cast<int64_t>(stats.misses),
+            static_cast<int64_t>(stats.entries)
+        };
+    });
+
+    exportAs("Land_getOwner", [](LandRef _landId) -> std::string {
+        auto land = resolveLand(_landId);
         if (!land) {
             return "";
         }
-        return land->getOwner().asString();
+        return formatUUID(land->getOwner());
     });
 
-    exportAs("Land_setOwner", [&registry](int _landId, std::string const& owner) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_setOwner", [](LandRef _landId, std::string const& owner) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
-        if (!mce::UUID::canParse(owner)) {
+        auto parsed = parseUUID(owner);
+        if (!parsed) {
             return false;
         }
-        land->setOwner(mce::UUID{owner});
+        land->setOwner(*parsed);
+        LandObserver::getInstance().notify({land->getId(), LandChangeKind::OwnerChanged});
         return true;
     });
 
-    exportAs("Land_getRawOwner", [&registry](int _landId) -> std::string {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getRawOwner", [](LandRef _landId) -> std::string {
+        auto land = resolveLand(_landId);
         if (!land) {
             return "";
         }
         return land->getRawOwner();
     });
 
-    exportAs("Land_getMembers", [&registry](int _landId) -> std::vector<std::string> {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getMembers", [](LandRef _landId) -> std::vector<std::string> {
+        auto land = resolveLand(_landId);
         if (!land) {
             return {};
         }
@@ -191,233 +526,289 @@ void Export_Class_Land() {
             landMembers.begin(),
             landMembers.end(),
             std::back_inserter(members),
-            [](mce::UUID const& member) -> std::string { return member.asString(); }
+            [](mce::UUID const& member) -> std::string { return formatUUID(member); }
         );
         return members;
     });
 
-    exportAs("Land_addLandMember", [&registry](int _landId, std::string const& member) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_addLandMember", [](LandRef _landId, std::string const& member) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
-        if (!mce::UUID::canParse(member)) {
+        auto parsed = parseUUID(member);
+        if (!parsed) {
+            return false;
+        }
+        if (!land->addLandMember(*parsed)) {
             return false;
         }
-        return land->addLandMember(mce::UUID{member});
+        LandObserver::getInstance().notify({land->getId(), LandChangeKind::MembersChanged});
+        return true;
     });
 
-    exportAs("Land_removeLandMember", [&registry](int _landId, std::string const& member) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_removeLandMember", [](LandRef _landId, std::string const& member) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
-        return land->removeLandMember(mce::UUID{member});
+        if (!land->removeLandMember(parseUUID(member).value_or(mce::UUID{}))) {
+            return false;
+        }
+        LandObserver::getInstance().notify({land->getId(), LandChangeKind::MembersChanged});
+        return true;
     });
 
-    exportAs("Land_getName", [&registry](int _landId) -> std::string {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getName", [](LandRef _landId) -> std::string {
+        auto land = resolveLand(_landId);
         if (!land) {
             return "";
         }
         return land->getName();
     });
 
-    exportAs("Land_setName", [&registry](int _landId, std::string const& name) -> void {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_setName", [](LandRef _landId, std::string const& name) -> void {
+        auto land = resolveLand(_landId);
         if (!land) {
             return;
         }
         land->setName(name);
     });
 
-    exportAs("Land_getOriginalBuyPrice", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getOriginalBuyPrice", [](LandRef _landId) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return 0;
         }
         return land->getOriginalBuyPrice();
     });
 
-    exportAs("Land_setOriginalBuyPrice", [&registry](int _landId, int originalBuyPrice) -> void {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_setOriginalBuyPrice", [](LandRef _landId, int originalBuyPrice) -> void {
+        auto land = resolveLand(_landId);
         if (!land) {
             return;
         }
         land->setOriginalBuyPrice(originalBuyPrice);
     });
 
-    exportAs("Land_is3D", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_is3D", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->is3D();
     });
 
-    exportAs("Land_isOwner", [&registry](int _landId, std::string const& uuid) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isOwner", [](LandRef _landId, std::string const& uuid) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return false;
         }
-        return land->isOwner(mce::UUID{uuid});
+        return land->isOwner(*parsed);
     });
 
-    exportAs("Land_isMember", [&registry](int _landId, std::string const& uuid) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isMember", [](LandRef _landId, std::string const& uuid) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return false;
         }
-        return land->isMember(mce::UUID{uuid});
+        return land->isMember(*parsed);
     });
 
-    exportAs("Land_isConvertedLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isConvertedLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isConvertedLand();
     });
 
-    exportAs("Land_isOwnerDataIsXUID", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isOwnerDataIsXUID", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isOwnerDataIsXUID();
     });
 
-    exportAs("Land_isCollision", [&registry](int _landId, IntPos pos, int radius) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isCollision", [](LandRef _landId, IntPos pos, int radius) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isCollision(toCpp<land::LandPos>(pos).as(), radius);
     });
 
-    exportAs("Land_isCollision2", [&registry](int _landId, IntPos a, IntPos b) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isCollision2", [](LandRef _landId, IntPos a, IntPos b) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isCollision(toCpp<land::LandPos>(a).as(), toCpp<land::LandPos>(b).as());
     });
 
-    exportAs("Land_isDirty", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isDirty", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isDirty();
     });
 
-    exportAs("Land_getType", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getType", [](LandRef _landId) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return land::INVALID_LAND_ID;
         }
         return static_cast<int>(land->getType());
     });
 
-    exportAs("Land_hasParentLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_hasParentLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->hasParentLand();
     });
 
-    exportAs("Land_hasSubLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_hasSubLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->hasSubLand();
     });
 
-    exportAs("Land_isSubLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isSubLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isSubLand();
     });
 
-    exportAs("Land_isParentLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isParentLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isParentLand();
     });
 
-    exportAs("Land_isMixLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isMixLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isMixLand();
     });
 
-    exportAs("Land_isOrdinaryLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_isOrdinaryLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->isOrdinaryLand();
     });
 
-    exportAs("Land_canCreateSubLand", [&registry](int _landId) -> bool {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_canCreateSubLand", [](LandRef _landId) -> bool {
+        auto land = resolveLand(_landId);
         if (!land) {
             return false;
         }
         return land->canCreateSubLand();
     });
 
-    exportAs("Land_getParentLandID", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getParentLandID", [](LandRef _landId) -> land::LandID {
+        auto land = resolveLand(_landId);
         if (!land) {
             return land::INVALID_LAND_ID;
         }
         return land->getParentLandID();
     });
 
-    exportAs("Land_getSubLandIDs", [&registry](int _landId) -> std::vector<int> {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getSubLandIDs", [](LandRef _landId) -> std::vector<land::LandID> {
+        auto land = resolveLand(_landId);
         if (!land) {
             return {};
         }
-        auto             subLands = land->getSubLandIDs();
-        std::vector<int> result;
-        result.reserve(subLands.size());
-        std::transform(subLands.begin(), subLands.end(), std::back_inserter(result), [](auto i) { return i; });
-        return result;
+        auto subLands = land->getSubLandIDs();
+        return std::vector<land::LandID>{subLands.begin(), subLands.end()};
     });
 
-    exportAs("Land_getNestedLevel", [&registry](int _landId) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getNestedLevel", [](LandRef _landId) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return land::INVALID_LAND_ID;
         }
         return land->getNestedLevel();
     });
 
-    exportAs("Land_getPermType", [&registry](int _landId, std::string const& uuid) -> int {
-        auto land = registry.getLand(_landId);
+    exportAs("Land_getPermType", [](LandRef _landId, std::string const& uuid) -> int {
+        auto land = resolveLand(_landId);
         if (!land) {
             return land::INVALID_LAND_ID;
         }
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return land::INVALID_LAND_ID;
         }
-        return static_cast<int>(land->getPermType(mce::UUID(uuid)));
+        return static_cast<int>(land->getPermType(*parsed));
+    });
+
+    // 领地句柄: 之后以句柄代替 ID 调用 Land_* / LandRegistry_* 时不再查询注册表，领地删除后句柄失效
+    exportAs("Land_getHandle", [](LandRef _landId) -> LandRef { return LandHandles::getInstance().acquire(_landId); });
+
+    // [slots, live]
+    exportAs("Land_getHandleStats", []() -> std::vector<int64_t> {
+        auto stats = LandHandles::getInstance().getStats();
+        return {static_cast<int64_t>(stats.slots), static_cast<int64_t>(stats.live)};
+    });
+
+    // 批量快照：每个领地只查询一次注册表，所有字段打包为一个 JSON 数组返回，不存在的领地对应 null
+    exportAs("Land_getSnapshots", [](std::vector<LandRef> ids, int fieldMask) -> std::string {
+        auto result = nlohmann::json::array();
+        for (auto id : ids) {
+            auto land = resolveLand(id);
+            if (!land) {
+                result.push_back(nullptr);
+                continue;
+            }
+            result.push_back(makeLandSnapshot(*land, fieldMask));
+        }
+        return result.dump();
+    });
+
+    // 批量修改：先校验全部操作 (领地 ID / UUID / 参数 / 成员变化)，任意一项失败则整体拒绝，全部通过后一次性应用
+    exportFfi("Land_applyBatch", [](std::string const& operations) -> FfiResult<nlohmann::json> {
+        auto ops = nlohmann::json::parse(operations, nullptr, false);
+        if (!ops.is_array()) {
+            return ffi_error("Land_applyBatch: operations must be a JSON array");
+        }
+
+        std::vector<LandBatchOp> prepared(ops.size());
+        for (size_t i = 0; i < ops.size(); ++i) {
+            if (auto err = prepareLandBatchOp(ops[i], prepared[i])) {
+                return ffi_error("Land_applyBatch: operation #{}: {}", i, *err);
+            }
+        }
+        if (auto err = checkLandBatchMembers(prepared)) {
+            return ffi_error("Land_applyBatch: operation #{}: {}", err->first, err->second);
+        }
+
+        auto results = nlohmann::json::array();
+        for (auto& op : prepared) {
+            results.push_back(applyLandBatchOp(op));
+        }
+        return ffi_success(results);
     });
 }
 
@@ -1,11 +1,126 @@
 #include "pland/aabb/LandAABB.h"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 #include "ExportDef.h"
 
 
 namespace ldapi {
 
 
+// 游标状态，与 ts/imports/LandAABB.ts 中的 RangeCursorState 保持一致
+enum class RangeCursorState : int { Invalid = -1, Active = 0, Finished = 1, Evicted = 2 };
+
+// 按 x -> z -> y 顺序惰性遍历 AABB 内的方块坐标 (与 LandAABB::getRange 一致)，每次只生成一段
+// 被淘汰、遍历完毕与无效的游标都返回空列表，需通过 state() 区分
+class RangeCursorManager {
+public:
+    static constexpr int    MaxChunkSize     = 16384; // 单次最多返回的坐标 / 列数
+    static constexpr size_t MaxOpenCursors   = 64;    // 同时存在的游标上限，超出时淘汰最早的游标
+    static constexpr size_t MaxEndedRecord   = 1024;  // 记录的已结束游标数量上限，超出时遗忘最早的记录
+
+    struct Cursor {
+        BlockPos min, max;
+        int      dimid;
+        int      x, z, y; // 下一个待输出的坐标
+    };
+
+    int open(land::LandAABB const& aabb, int dimid) {
+        if (mCursors.size() >= MaxOpenCursors) {
+            end(mCursors.begin(), RangeCursorState::Evicted);
+        }
+        auto min = aabb.min.as();
+        auto max = aabb.max.as();
+        auto id  = mNextId++;
+        mCursors.emplace(id, Cursor{min, max, dimid, min.x, min.z, min.y});
+        return id;
+    }
+
+    void close(int id) {
+        mCursors.erase(id);
+        mEnded.erase(id);
+    }
+
+    RangeCursorState state(int id) const {
+        if (mCursors.contains(id)) {
+            return RangeCursorState::Active;
+        }
+        auto iter = mEnded.find(id);
+        return iter == mEnded.end() ? RangeCursorState::Invalid : iter->second;
+    }
+
+    std::vector<IntPos> next(int id, int maxCount) {
+        auto iter = mCursors.find(id);
+        if (iter == mCursors.end()) {
+            return {};
+        }
+        auto&               c     = iter->second;
+        auto                limit = static_cast<size_t>(std::clamp(maxCount, 1, MaxChunkSize));
+        std::vector<IntPos> res;
+        res.reserve(limit);
+        while (res.size() < limit && c.x <= c.max.x) {
+            res.emplace_back(BlockPos{c.x, c.y, c.z}, c.dimid);
+            advance(c, c.y + 1);
+        }
+        if (res.empty()) {
+            end(iter, RangeCursorState::Finished); // 遍历完毕，自动释放
+        }
+        return res;
+    }
+
+    // 以列为单位输出: [x, z, yFrom, yTo]
+    std::vector<std::vector<int>> nextRuns(int id, int maxCount) {
+        auto iter = mCursors.find(id);
+        if (iter == mCursors.end()) {
+            return {};
+        }
+        auto&                         c     = iter->second;
+        auto                          limit = static_cast<size_t>(std::clamp(maxCount, 1, MaxChunkSize));
+        std::vector<std::vector<int>> res;
+        res.reserve(limit);
+        while (res.size() < limit && c.x <= c.max.x) {
+            res.push_back({c.x, c.z, c.y, c.max.y});
+            advance(c, c.max.y + 1);
+        }
+        if (res.empty()) {
+            end(iter, RangeCursorState::Finished);
+        }
+        return res;
+    }
+
+    static RangeCursorManager& getInstance() {
+        static RangeCursorManager instance;
+        return instance;
+    }
+
+private:
+    void end(std::map<int, Cursor>::iterator iter, RangeCursorState state) {
+        mEnded[iter->first] = state;
+        mCursors.erase(iter);
+        if (mEnded.size() > MaxEndedRecord) {
+            mEnded.erase(mEnded.begin());
+        }
+    }
+
+    static void advance(Cursor& c, int y) {
+        c.y = y;
+        if (c.y > c.max.y) {
+            c.y = c.min.y;
+            if (++c.z > c.max.z) {
+                c.z = c.min.z;
+                ++c.x;
+            }
+        }
+    }
+
+    int                   mNextId{0};
+    std::map<int, Cursor>           mCursors; // 有序，begin() 即最早打开的游标
+    std::map<int, RangeCursorState> mEnded;   // 已结束 (遍历完毕 / 被淘汰) 的游标，close() 时移除
+};
+
+
 void Export_Class_LandAABB() {
     static auto Make = [](IntPos a, IntPos b) {
         return land::LandAABB::make(land::LandPos::make(a.first), land::LandPos::make(b.first));
@@ -71,6 +186,27 @@ void Export_Class_LandAABB() {
         return li;
     });
 
+    exportAs("LandAABB_openRange", [](IntPos a, IntPos b) -> int {
+        auto p = Make(a, b);
+        p.fix();
+        return RangeCursorManager::getInstance().open(p, a.second);
+    });
+
+    exportAs("LandAABB_nextRange", [](int handle, int maxCount) -> std::vector<IntPos> {
+        return RangeCursorManager::getInstance().next(handle, maxCount);
+    });
+
+    exportAs("LandAABB_nextRangeRuns", [](int handle, int maxCount) -> std::vector<std::vector<int>> {
+        return RangeCursorManager::getInstance().nextRuns(handle, maxCount);
+    });
+
+    exportAs("LandAABB_closeRange", [](int handle) -> void { RangeCursorManager::getInstance().close(handle); });
+
+    // 见 RangeCursorState，已关闭、从未打开或结束记录已被遗忘的句柄为 Invalid (-1)
+    exportAs("LandAABB_getRangeState", [](int handle) -> int {
+        return static_cast<int>(RangeCursorManager::getInstance().state(handle));
+    });
+
     exportAs("LandAABB_getVertices", [](IntPos a, IntPos b) -> std::vector<FloatPos> {
         auto                  ab = Make(a, b);
         std::vector<FloatPos> res;
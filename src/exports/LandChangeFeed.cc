@@ -0,0 +1,46 @@
+#include "exports/LandChangeFeed.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+
+namespace ldapi {
+
+
+LandChangeFeed::LandChangeFeed() : mEntries(Capacity) {
+    LandObserver::getInstance().subscribe([this](LandChange const& change) {
+        mEntries[static_cast<size_t>(mVersion) % Capacity] = {change.id, change.kind};
+        ++mVersion;
+    });
+}
+
+LandChangeFeed::Changes LandChangeFeed::changesSince(int64_t since) const {
+    Changes result{mVersion, false, {}};
+    auto    oldest = std::max<int64_t>(mVersion - static_cast<int64_t>(Capacity), 0); // 仍保留的最早版本 - 1
+    if (since < oldest || since > mVersion) {
+        result.resync = true;
+        return result;
+    }
+
+    std::unordered_map<land::LandID, size_t> slots; // 领地在结果中的位置
+    for (auto version = since; version < mVersion; ++version) {
+        auto& entry = mEntries[static_cast<size_t>(version) % Capacity];
+        auto  bit   = 1u << static_cast<uint32_t>(entry.kind);
+
+        auto [iter, inserted] = slots.try_emplace(entry.id, result.lands.size());
+        if (inserted) {
+            result.lands.emplace_back(entry.id, bit);
+        } else {
+            result.lands[iter->second].second |= bit;
+        }
+    }
+    return result;
+}
+
+LandChangeFeed& LandChangeFeed::getInstance() {
+    static LandChangeFeed instance;
+    return instance;
+}
+
+
+} // namespace ldapi
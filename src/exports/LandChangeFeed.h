@@ -0,0 +1,51 @@
+#pragma once
+#include "pland/Global.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+
+/**
+ * 领地变更日志，供脚本侧的领地镜像增量同步
+ * 每条 LandObserver 变更分配一个递增的版本号，存入定长环形缓冲；被覆盖的版本只能通过全量同步补回
+ */
+class LandChangeFeed {
+public:
+    static constexpr size_t Capacity = 1 << 16;
+
+    using LandMask = std::pair<land::LandID, uint32_t>; // 领地 ID 与变更类型掩码 (1 << LandChangeKind)
+
+    struct Changes {
+        int64_t               version; // 当前版本，下次以此查询
+        bool                  resync;  // 请求的版本已被覆盖，需要全量同步
+        std::vector<LandMask> lands;
+    };
+
+    /// since 之后 (不含) 的变更，按领地合并；since < 0 时只返回当前版本并要求全量同步
+    [[nodiscard]] Changes changesSince(int64_t since) const;
+
+    [[nodiscard]] int64_t getVersion() const { return mVersion; }
+
+    static LandChangeFeed& getInstance();
+
+private:
+    LandChangeFeed();
+
+    struct Entry {
+        land::LandID   id;
+        LandChangeKind kind;
+    };
+
+    int64_t            mVersion{0};
+    std::vector<Entry> mEntries; // 版本 v 位于 (v - 1) % Capacity
+};
+
+
+} // namespace ldapi
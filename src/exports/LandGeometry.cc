@@ -0,0 +1,130 @@
+#include "exports/LandGeometry.h"
+
+#include "pland/PLand.h"
+#include "pland/aabb/LandAABB.h"
+#include "pland/land/Land.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "ExportDef.h"
+#include "exports/LandHandles.h"
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+
+std::vector<BorderSegment> makeBorderSegments(BlockPos const& min, BlockPos const& max) {
+    auto distinct = [](int a, int b) { return a == b ? std::vector<int>{a} : std::vector<int>{a, b}; };
+
+    auto xs = distinct(min.x, max.x);
+    auto ys = distinct(min.y, max.y);
+    auto zs = distinct(min.z, max.z);
+
+    // 跨度为 0 的轴上的棱退化为点，已被其它棱覆盖
+    std::vector<BorderSegment> segments;
+    segments.reserve(12);
+    if (min.x != max.x) {
+        for (auto y : ys) {
+            for (auto z : zs) segments.push_back({BlockPos{min.x, y, z}, BlockPos{max.x, y, z}, Axis::X});
+        }
+    }
+    if (min.y != max.y) {
+        for (auto x : xs) {
+            for (auto z : zs) segments.push_back({BlockPos{x, min.y, z}, BlockPos{x, max.y, z}, Axis::Y});
+        }
+    }
+    if (min.z != max.z) {
+        for (auto x : xs) {
+            for (auto y : ys) segments.push_back({BlockPos{x, y, min.z}, BlockPos{x, y, max.z}, Axis::Z});
+        }
+    }
+    if (segments.empty()) {
+        segments.push_back({min, max, Axis::X}); // 单个方块
+    }
+    return segments;
+}
+
+std::vector<int> encodeBorderSegment(BorderSegment const& segment, int step) {
+    auto length = std::max({
+        segment.end.x - segment.start.x,
+        segment.end.y - segment.start.y,
+        segment.end.z - segment.start.z,
+    });
+    step       = std::max(step, 1);
+    auto count = length / step + 1 + (length % step != 0 ? 1 : 0); // 终点不在步长上时补一个点
+
+    auto& [s, e, axis] = segment;
+    return {s.x, s.y, s.z, e.x, e.y, e.z, static_cast<int>(axis), count};
+}
+
+
+// 按领地缓存棱线段，领地范围变化或删除时失效
+class LandGeometryCache {
+public:
+    struct Entry {
+        BlockPos                   min, max;
+        std::vector<BorderSegment> segments;
+    };
+
+    LandGeometryCache() {
+        LandObserver::getInstance().subscribe([this](LandChange const& change) {
+            if (change.kind == LandChangeKind::Removed || change.kind == LandChangeKind::Resized) {
+                mEntries.erase(change.id);
+            }
+        });
+    }
+
+    std::vector<BorderSegment> const& get(land::Land const& land) {
+        auto  min   = land.getAABB().min.as();
+        auto  max   = land.getAABB().max.as();
+        auto& entry = mEntries[land.getId()];
+        // 同时比对范围，防止遗漏未经过事件的范围修改
+        if (entry.segments.empty() || entry.min != min || entry.max != max) {
+            entry.min      = min;
+            entry.max      = max;
+            entry.segments = makeBorderSegments(min, max);
+        }
+        return entry.segments;
+    }
+
+    static LandGeometryCache& getInstance() {
+        static LandGeometryCache instance;
+        return instance;
+    }
+
+private:
+    std::unordered_map<land::LandID, Entry> mEntries;
+};
+
+
+void Export_LandGeometry() {
+    auto* cache = &LandGeometryCache::getInstance();
+
+    exportAs("Land_getBorderSegments", [cache](LandRef _landId, int step) -> std::vector<std::vector<int>> {
+        auto land = resolveLand(_landId);
+        if (!land) {
+            return {};
+        }
+        std::vector<std::vector<int>> res;
+        for (auto& segment : cache->get(*land)) {
+            res.push_back(encodeBorderSegment(segment, step));
+        }
+        return res;
+    });
+
+    exportAs("LandAABB_getBorderSegments", [](IntPos a, IntPos b, int step) -> std::vector<std::vector<int>> {
+        auto aabb = land::LandAABB::make(land::LandPos::make(a.first), land::LandPos::make(b.first));
+        aabb.fix();
+        std::vector<std::vector<int>> res;
+        for (auto& segment : makeBorderSegments(aabb.min.as(), aabb.max.as())) {
+            res.push_back(encodeBorderSegment(segment, step));
+        }
+        return res;
+    });
+}
+
+
+} // namespace ldapi
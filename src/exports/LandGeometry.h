@@ -0,0 +1,31 @@
+#pragma once
+#include "mc/world/level/BlockPos.h"
+
+#include <vector>
+
+
+namespace ldapi {
+
+
+enum class Axis : int { X = 0, Y = 1, Z = 2 };
+
+struct BorderSegment {
+    BlockPos start;
+    BlockPos end;
+    Axis     axis;
+};
+
+/**
+ * @brief 获取 AABB 的棱线段 (最多 12 条，退化轴上的重复棱会被合并)
+ * 线段覆盖的方块与 LandAABB::getBorder 一致，但数据量只与棱数相关
+ */
+std::vector<BorderSegment> makeBorderSegments(BlockPos const& min, BlockPos const& max);
+
+/**
+ * @brief 编码线段: [x0, y0, z0, x1, y1, z1, axis, count]
+ * @param step 抽样步长，count 为每隔 step 个方块取一点 (含两端) 后的点数
+ */
+std::vector<int> encodeBorderSegment(BorderSegment const& segment, int step);
+
+
+} // namespace ldapi
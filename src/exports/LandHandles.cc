@@ -0,0 +1,77 @@
+#include "exports/LandHandles.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+
+LandHandles::LandHandles() {
+    LandObserver::getInstance().subscribe([this](LandChange const& change) {
+        if (change.kind == LandChangeKind::Removed) {
+            release(change.id);
+        }
+    });
+}
+
+LandRef LandHandles::acquire(LandRef ref) {
+    auto land = resolve(ref);
+    if (!land) {
+        return land::INVALID_LAND_ID;
+    }
+
+    auto [iter, inserted] = mSlotOf.try_emplace(land->getId(), 0);
+    if (inserted) {
+        if (mFree.empty()) {
+            iter->second = static_cast<uint32_t>(mSlots.size());
+            mSlots.emplace_back();
+        } else {
+            iter->second = mFree.back();
+            mFree.pop_back();
+        }
+        mSlots[iter->second].land = land;
+    }
+    auto  index = iter->second;
+    auto& slot  = mSlots[index];
+    return -static_cast<LandRef>((slot.generation << SlotBits) | index) - 2;
+}
+
+land::SharedLand LandHandles::resolve(LandRef ref) const {
+    if (ref >= 0) {
+        return land::PLand::getInstance().getLandRegistry().getLand(static_cast<land::LandID>(ref));
+    }
+    if (ref == land::INVALID_LAND_ID) {
+        return nullptr;
+    }
+    auto raw        = static_cast<uint64_t>(-(ref + 2));
+    auto index      = raw & ((uint64_t{1} << SlotBits) - 1);
+    auto generation = raw >> SlotBits;
+    if (index >= mSlots.size() || mSlots[index].generation != generation) {
+        return nullptr;
+    }
+    return mSlots[index].land.lock(); // 已释放时为空
+}
+
+void LandHandles::release(land::LandID id) {
+    auto iter = mSlotOf.find(id);
+    if (iter == mSlotOf.end()) {
+        return;
+    }
+    auto& slot = mSlots[iter->second];
+    slot.land.reset();
+    if (++slot.generation <= MaxGeneration) {
+        mFree.push_back(iter->second);
+    }
+    mSlotOf.erase(iter);
+}
+
+LandHandles& LandHandles::getInstance() {
+    static LandHandles instance;
+    return instance;
+}
+
+
+} // namespace ldapi
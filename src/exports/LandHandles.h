@@ -0,0 +1,63 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/land/Land.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+namespace ldapi {
+
+
+/// 脚本传入的领地引用: 非负数为 LandID，小于 -1 为 LandHandles 分配的句柄 (int64，在 JS number 中可精确表示)
+using LandRef = int64_t;
+
+/**
+ * 领地句柄: 槽位下标 + 代数，编码为负数 -((generation << SlotBits) | slot) - 2
+ * 槽位以 weak_ptr 引用领地，解析句柄只需一次数组下标、代数比较与 lock()，不查询注册表
+ * 领地删除时槽位清空并递增代数，旧句柄随之失效；即使漏掉删除通知，注册表释放领地后 lock() 也会失败
+ * 槽位可复用，代数用尽的槽位不再复用
+ */
+class LandHandles {
+public:
+    static constexpr int      SlotBits      = 32;
+    static constexpr uint64_t MaxGeneration = (uint64_t{1} << 20) - 1; // 与槽位合计 52 位
+
+    struct Stats {
+        size_t slots;
+        size_t live;
+    };
+
+    /// 获取领地的句柄 (同一块领地复用同一槽位)，领地不存在时返回 INVALID_LAND_ID
+    LandRef acquire(LandRef ref);
+
+    /// 解析领地 ID 或句柄，不存在 / 句柄失效时返回 nullptr
+    [[nodiscard]] land::SharedLand resolve(LandRef ref) const;
+
+    [[nodiscard]] Stats getStats() const { return {mSlots.size(), mSlotOf.size()}; }
+
+    static LandHandles& getInstance();
+
+private:
+    LandHandles();
+
+    struct Slot {
+        std::weak_ptr<land::Land> land;
+        uint64_t                  generation{1};
+    };
+
+    void release(land::LandID id);
+
+    std::vector<Slot>                          mSlots;
+    std::vector<uint32_t>                      mFree;
+    std::unordered_map<land::LandID, uint32_t> mSlotOf;
+};
+
+
+inline land::SharedLand resolveLand(LandRef ref) { return LandHandles::getInstance().resolve(ref); }
+
+
+} // namespace ldapi
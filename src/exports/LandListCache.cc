@@ -0,0 +1,149 @@
+#include "exports/LandListCache.h"
+
+#include "pland/PLand.h"
+#include "pland/land/Land.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include <algorithm>
+
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+
+LandListCache::LandListCache() {
+    LandObserver::getInstance().subscribe([this](LandChange const& change) {
+        switch (change.kind) {
+        case LandChangeKind::Created:
+            ++mGeneration;
+            insert(change.id);
+            break;
+        case LandChangeKind::Removed:
+            ++mGeneration;
+            erase(change.id);
+            break;
+        case LandChangeKind::Resized:
+            ++mGeneration; // 范围变化不影响 ID 列表，仅通知脚本
+            break;
+        case LandChangeKind::OwnerChanged:
+        case LandChangeKind::MembersChanged:
+        case LandChangeKind::StateChanged:
+            break;
+        }
+    });
+}
+
+void LandListCache::ensureBuilt() {
+    if (!mBuilt) {
+        rebuild();
+    }
+}
+
+void LandListCache::rebuild() {
+    mAll.clear();
+    mByDimension.clear();
+    for (auto& land : land::PLand::getInstance().getLandRegistry().getLands()) {
+        mAll.push_back(land->getId());
+        mByDimension[land->getDimensionId()].push_back(land->getId());
+    }
+    std::sort(mAll.begin(), mAll.end());
+    for (auto& [dimid, ids] : mByDimension) {
+        std::sort(ids.begin(), ids.end());
+    }
+    if (!mAll.empty()) {
+        mMaxSeen = std::max(mMaxSeen, mAll.back());
+    }
+    mBuilt = true;
+}
+
+/**
+ * 轮流抽查 SampleSize 个已缓存的 ID 是否仍在注册表中 (漏掉的删除)，
+ * 并检查见过的最大 ID 的下一个是否已存在 (PLand 顺序分配 ID，漏掉的创建必然从这里开始)
+ */
+void LandListCache::spotCheck() {
+    if (!mCrossCheck) {
+        return;
+    }
+    auto& registry = land::PLand::getInstance().getLandRegistry();
+    auto  stale    = registry.hasLand(mMaxSeen + 1);
+    for (size_t i = 0; i < SampleSize && i < mAll.size() && !stale; ++i) {
+        mCheckCursor = (mCheckCursor + 1) % mAll.size();
+        stale        = !registry.hasLand(mAll[mCheckCursor]);
+    }
+    if (stale) {
+        ++mMismatches;
+        rebuild();
+        ++mGeneration;
+    }
+}
+
+// 有序插入，重复通知时忽略
+static void insertSorted(std::vector<land::LandID>& ids, land::LandID id) {
+    auto pos = std::lower_bound(ids.begin(), ids.end(), id);
+    if (pos == ids.end() || *pos != id) {
+        ids.insert(pos, id);
+    }
+}
+
+static bool eraseSorted(std::vector<land::LandID>& ids, land::LandID id) {
+    auto pos = std::lower_bound(ids.begin(), ids.end(), id);
+    if (pos == ids.end() || *pos != id) {
+        return false;
+    }
+    ids.erase(pos);
+    return true;
+}
+
+void LandListCache::insert(land::LandID id) {
+    if (!mBuilt) {
+        return; // 构建时会从注册表读取
+    }
+    auto land = land::PLand::getInstance().getLandRegistry().getLand(id);
+    if (!land) {
+        return;
+    }
+    mMaxSeen = std::max(mMaxSeen, id);
+    insertSorted(mAll, id);
+    insertSorted(mByDimension[land->getDimensionId()], id);
+}
+
+void LandListCache::erase(land::LandID id) {
+    if (!mBuilt || !eraseSorted(mAll, id)) {
+        return;
+    }
+    // 领地已从注册表移除，无法得知维度，维度数量很少，逐个查找
+    for (auto& [dimid, ids] : mByDimension) {
+        if (eraseSorted(ids, id)) {
+            break;
+        }
+    }
+}
+
+uint64_t LandListCache::getGeneration() {
+    ensureBuilt();
+    spotCheck();
+    return mGeneration;
+}
+
+LandListCache::LandList const& LandListCache::getAll() {
+    ensureBuilt();
+    spotCheck();
+    return mAll;
+}
+
+LandListCache::LandList const& LandListCache::getByDimension(land::LandDimid dimid) {
+    static LandList const empty;
+    ensureBuilt();
+    spotCheck();
+    auto iter = mByDimension.find(dimid);
+    return iter == mByDimension.end() ? empty : iter->second;
+}
+
+LandListCache& LandListCache::getInstance() {
+    static LandListCache instance;
+    return instance;
+}
+
+
+} // namespace ldapi
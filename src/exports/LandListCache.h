@@ -0,0 +1,62 @@
+#pragma once
+#include "pland/Global.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+namespace ldapi {
+
+
+/**
+ * 按维度划分、已排序的领地 ID 列表
+ * 首次查询时从注册表构建，之后随领地创建 / 删除有序插入 / 删除单个 ID，查询直接返回列表
+ * 创建 / 删除 / 范围变化时递增代数，脚本可据此跳过整表查询
+ * 正确性依赖 LandObserver 的变更通知；校验模式下每次读取还会抽查少量 ID，
+ * 发现漏掉的创建 / 删除通知时从注册表重建并递增代数 (仅用于排查)
+ */
+class LandListCache {
+public:
+    using LandList = std::vector<land::LandID>;
+
+    static constexpr size_t SampleSize = 16; // 校验模式下每次读取抽查的已缓存 ID 数量
+
+    uint64_t getGeneration();
+
+    /// 全部领地
+    LandList const& getAll();
+
+    /// 指定维度的领地
+    LandList const& getByDimension(land::LandDimid dimid);
+
+    void setCrossCheck(bool enabled) { mCrossCheck = enabled; }
+
+    [[nodiscard]] bool isCrossCheck() const { return mCrossCheck; }
+
+    /// 校验模式下发现并重建的次数
+    [[nodiscard]] uint64_t getMismatches() const { return mMismatches; }
+
+    static LandListCache& getInstance();
+
+private:
+    LandListCache();
+
+    void ensureBuilt();
+    void rebuild();
+    void spotCheck(); // 仅校验模式
+    void insert(land::LandID id);
+    void erase(land::LandID id);
+
+    bool                                          mBuilt{false};
+    bool                                          mCrossCheck{false};
+    uint64_t                                      mGeneration{1};
+    uint64_t                                      mMismatches{0};
+    size_t                                        mCheckCursor{0};
+    land::LandID                                  mMaxSeen{land::INVALID_LAND_ID}; // 见过的最大 ID
+    LandList                                      mAll;
+    std::unordered_map<land::LandDimid, LandList> mByDimension;
+};
+
+
+} // namespace ldapi
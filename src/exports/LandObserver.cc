@@ -0,0 +1,59 @@
+#include "exports/LandObserver.h"
+
+#include "ll/api/event/EventBus.h"
+
+#include "pland/land/Land.h"
+
+#include "pland/events/domain/LandRecycleEvent.h"
+#include "pland/events/domain/LandResizedEvent.h"
+#include "pland/events/domain/LandStateChangedEvent.h"
+#include "pland/events/domain/MemberChangedEvent.h" // MembersClearedEvent
+#include "pland/events/domain/OwnerChangedEvent.h"
+#include "pland/events/player/PlayerBuyLandEvent.h"
+#include "pland/events/player/PlayerDeleteLandEvent.h"
+#include "pland/events/player/PlayerTransferLandEvent.h"
+
+
+namespace ldapi {
+
+
+// 将携带 land() 的 PLand 事件转发为 LandChange
+template <typename T>
+ll::event::ListenerPtr LandObserver::forward(LandChangeKind kind) {
+    return ll::event::EventBus::getInstance().emplaceListener<T>([this, kind](T& ev) {
+        notify({ev.land()->getId(), kind});
+    });
+}
+
+void LandObserver::subscribe(Handler handler) {
+    if (mListeners.empty()) {
+        attach();
+    }
+    mHandlers.push_back(std::move(handler));
+}
+
+void LandObserver::notify(LandChange const& change) {
+    for (auto& handler : mHandlers) {
+        handler(change);
+    }
+}
+
+void LandObserver::attach() {
+    mListeners.push_back(forward<land::event::PlayerBuyLandAfterEvent>(LandChangeKind::Created));
+    mListeners.push_back(forward<land::event::PlayerDeleteLandAfterEvent>(LandChangeKind::Removed));
+    mListeners.push_back(forward<land::event::LandRecycleEvent>(LandChangeKind::Removed)); // 租赁到期 / 强制回收
+    mListeners.push_back(forward<land::event::LandResizedEvent>(LandChangeKind::Resized));
+    mListeners.push_back(forward<land::event::OwnerChangedEvent>(LandChangeKind::OwnerChanged));
+    mListeners.push_back(forward<land::event::PlayerTransferLandAfterEvent>(LandChangeKind::OwnerChanged));
+    mListeners.push_back(forward<land::event::MemberChangedEvent>(LandChangeKind::MembersChanged));
+    mListeners.push_back(forward<land::event::MembersClearedEvent>(LandChangeKind::MembersChanged));
+    mListeners.push_back(forward<land::event::LandStateChangedEvent>(LandChangeKind::StateChanged));
+}
+
+LandObserver& LandObserver::getInstance() {
+    static LandObserver instance;
+    return instance;
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,55 @@
+#pragma once
+#include "ll/api/event/ListenerBase.h"
+
+#include "pland/Global.h"
+
+#include <functional>
+#include <vector>
+
+
+namespace ldapi {
+
+
+// 领地变更类型
+enum class LandChangeKind : int {
+    Created        = 0,
+    Removed        = 1,
+    Resized        = 2,
+    OwnerChanged   = 3,
+    MembersChanged = 4, // 成员增删或清空
+    StateChanged   = 5, // 租赁状态变化
+};
+
+struct LandChange {
+    land::LandID   id;
+    LandChangeKind kind;
+};
+
+/**
+ * 原生侧的领地变更通知
+ * 统一监听 PLand 事件并分发给各个缓存 / 索引，导出函数自身引起的变更也通过 notify 上报
+ * 同一变更可能由事件与导出函数各上报一次，处理器需要容忍重复通知
+ */
+class LandObserver {
+public:
+    using Handler = std::function<void(LandChange const&)>;
+
+    /// 注册处理器，首次注册时挂载 PLand 事件监听
+    void subscribe(Handler handler);
+
+    void notify(LandChange const& change);
+
+    static LandObserver& getInstance();
+
+private:
+    void attach();
+
+    template <typename T>
+    ll::event::ListenerPtr forward(LandChangeKind kind);
+
+    std::vector<Handler>                mHandlers;
+    std::vector<ll::event::ListenerPtr> mListeners;
+};
+
+
+} // namespace ldapi
@@ -0,0 +1,158 @@
+#include "exports/LandPresenceBatch.h"
+
+#include "ll/api/chrono/GameChrono.h"
+#include "ll/api/coro/CoroTask.h"
+#include "ll/api/event/EventBus.h"
+#include "ll/api/thread/ServerThreadExecutor.h"
+
+#include "mc/world/actor/player/Player.h"
+
+#include "pland/events/player/PlayerMoveEvent.h"
+
+#include "exports/UUIDCache.h"
+
+
+namespace ldapi {
+
+
+void LandPresenceBatcher::add(
+    int                               handle,
+    Callback                          callback,
+    std::chrono::milliseconds         interval,
+    std::optional<EventFilter>        filter,
+    std::shared_ptr<ListenerCounters> counters
+) {
+    attach();
+    mListeners.emplace(
+        handle,
+        BatchListener{
+            std::move(callback),
+            interval,
+            std::move(filter),
+            std::move(counters),
+            std::chrono::steady_clock::now(),
+            {},
+            {}
+        }
+    );
+}
+
+bool LandPresenceBatcher::remove(int handle) { return mListeners.erase(handle) != 0; }
+
+void LandPresenceBatcher::attach() {
+    if (mAttached) {
+        return;
+    }
+    mAttached = true;
+
+    auto& bus = ll::event::EventBus::getInstance();
+    mNativeListeners.push_back(bus.emplaceListener<land::event::PlayerEnterLandEvent>([this](auto& ev) {
+        push(ev.self().getUuid(), ev.landId(), PresenceKind::Enter);
+    }));
+    mNativeListeners.push_back(bus.emplaceListener<land::event::PlayerLeaveLandEvent>([this](auto& ev) {
+        push(ev.self().getUuid(), ev.landId(), PresenceKind::Leave);
+    }));
+
+    ll::coro::keepThis([this]() -> ll::coro::CoroTask<> {
+        while (true) {
+            co_await ll::chrono::ticks{1};
+            flush();
+        }
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
+}
+
+void LandPresenceBatcher::push(mce::UUID const& player, land::LandID landId, PresenceKind kind) {
+    land::SharedLand land; // 仅在有过滤器时查询一次
+    bool             resolved = false;
+    for (auto& [handle, listener] : mListeners) {
+        if (listener.filter) {
+            if (!resolved) {
+                land     = land::PLand::getInstance().getLandRegistry().getLand(landId);
+                resolved = true;
+            }
+            if (!land || !listener.filter->matches(*land)) {
+                ++listener.counters->skipped;
+                continue;
+            }
+        }
+        enqueue(listener, {player, landId, kind, true});
+    }
+}
+
+void LandPresenceBatcher::enqueue(BatchListener& listener, Record record) {
+    RecordKey key{record.player, record.landId};
+    if (auto iter = listener.pending.find(key); iter != listener.pending.end()) {
+        auto& last = listener.records[iter->second];
+        if (last.kind != record.kind) {
+            // 窗口内进入后又离开 (或反之)，两条记录相互抵消
+            last.live = false;
+            listener.pending.erase(iter);
+        }
+        return; // 同类记录重复，保留第一条即可
+    }
+    listener.pending.emplace(key, listener.records.size());
+    listener.records.push_back(record);
+}
+
+void LandPresenceBatcher::flush() {
+    auto now = std::chrono::steady_clock::now();
+
+    // 回调中可能注册 / 移除监听器，先记录本轮需要处理的句柄
+    std::vector<int> handles;
+    handles.reserve(mListeners.size());
+    for (auto& [handle, listener] : mListeners) {
+        handles.push_back(handle);
+    }
+
+    for (auto handle : handles) {
+        auto iter = mListeners.find(handle);
+        if (iter == mListeners.end()) {
+            continue;
+        }
+        auto& listener = iter->second;
+        if (listener.records.empty() || now - listener.lastFlush < listener.interval) {
+            continue;
+        }
+        listener.lastFlush = now;
+
+        std::vector<std::string>  uuids;
+        std::vector<land::LandID> landIds;
+        std::vector<int>          kinds;
+        uuids.reserve(listener.records.size());
+        landIds.reserve(listener.records.size());
+        kinds.reserve(listener.records.size());
+        for (auto& record : listener.records) {
+            if (!record.live) {
+                continue;
+            }
+            uuids.push_back(formatUUID(record.player));
+            landIds.push_back(record.landId);
+            kinds.push_back(static_cast<int>(record.kind));
+        }
+        listener.records.clear();
+        listener.pending.clear();
+        if (uuids.empty()) {
+            continue;
+        }
+        listener.counters->delivered += uuids.size();
+
+        auto callback = listener.callback; // 回调中可能移除自身
+        auto counters = listener.counters;
+        auto begin    = std::chrono::steady_clock::now();
+        bool threw    = false;
+        try {
+            callback(std::move(uuids), std::move(landIds), std::move(kinds));
+        } catch (...) {
+            threw = true;
+        }
+        counters->dispatch.record(begin, false, threw);
+    }
+}
+
+LandPresenceBatcher& LandPresenceBatcher::getInstance() {
+    static LandPresenceBatcher instance;
+    return instance;
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,91 @@
+#pragma once
+#include "pland/Global.h"
+
+#include "ll/api/event/ListenerBase.h"
+
+#include "mc/platform/UUID.h"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "exports/LDEvents.h"
+
+
+namespace ldapi {
+
+
+enum class PresenceKind : int { Enter = 0, Leave = 1 };
+
+/**
+ * PlayerEnterLandEvent / PlayerLeaveLandEvent 的批量投递
+ * 事件先在原生侧排队，每 tick (或每隔 interval) 以一次脚本调用投递:
+ *   callback(uuids: string[], landIds: LandID[], kinds: int[]) -> bool (返回值忽略)
+ * 同一窗口内同一玩家对同一领地的 进入 + 离开 (或 离开 + 进入) 会相互抵消
+ */
+class LandPresenceBatcher {
+public:
+    using Callback = std::function<bool(std::vector<std::string>, std::vector<land::LandID>, std::vector<int>)>;
+
+    void add(
+        int                               handle,
+        Callback                          callback,
+        std::chrono::milliseconds         interval,
+        std::optional<EventFilter>        filter,
+        std::shared_ptr<ListenerCounters> counters
+    );
+    bool remove(int handle);
+
+    static LandPresenceBatcher& getInstance();
+
+private:
+    LandPresenceBatcher() = default;
+
+    struct Record {
+        mce::UUID    player;
+        land::LandID landId;
+        PresenceKind kind;
+        bool         live;
+    };
+
+    struct RecordKey {
+        mce::UUID    player;
+        land::LandID landId;
+
+        bool operator==(RecordKey const&) const = default;
+    };
+    struct RecordKeyHash {
+        size_t operator()(RecordKey const& key) const noexcept {
+            return std::hash<mce::UUID>{}(key.player) ^ (std::hash<land::LandID>{}(key.landId) * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    struct BatchListener {
+        Callback                                             callback;
+        std::chrono::milliseconds                            interval;
+        std::optional<EventFilter>                           filter;
+        std::shared_ptr<ListenerCounters>                    counters;
+        std::chrono::steady_clock::time_point                lastFlush;
+        std::vector<Record>                                  records;
+        std::unordered_map<RecordKey, size_t, RecordKeyHash> pending; // 窗口内每个 (玩家, 领地) 最后一条记录
+    };
+
+    void attach();
+    void push(mce::UUID const& player, land::LandID landId, PresenceKind kind);
+    void flush();
+
+    static void enqueue(BatchListener& listener, Record record);
+
+    bool                                mAttached{false};
+    std::vector<ll::event::ListenerPtr> mNativeListeners;
+    std::map<int, BatchListener>        mListeners; // key: 句柄
+};
+
+
+} // namespace ldapi
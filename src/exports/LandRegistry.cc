@@ -11,15 +11,77 @@
 #include "mc/platform/UUID.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "ExportDef.h"
+#include "exports/LandChangeFeed.h"
+#include "exports/LandHandles.h"
+#include "exports/LandListCache.h"
+#include "exports/LandObserver.h"
+#include "exports/OwnerIndex.h"
+#include "exports/UUIDCache.h"
 
 
 namespace ldapi {
 
 
+enum class LandConflictType : int { Overlap = 0, Spacing = 1, Containment = 2 };
+
+// 纵向不参与判定时，查询范围覆盖整个高度
+static constexpr int AnyYMin = -32768;
+static constexpr int AnyYMax = 32767;
+
+/**
+ * 检查拟建范围与已有领地的冲突: 先按扩展了 minSpacing 的范围走注册表的区块索引取候选，再逐块精确判定
+ * 一块领地只报告一种冲突，优先级为 包含 > 重叠 > 间距不足
+ */
+static std::vector<std::pair<land::LandID, LandConflictType>> findConflicts(
+    land::LandAABB             aabb,
+    land::LandDimid            dimid,
+    int                        minSpacing,
+    bool                       includeY,
+    std::vector<land::LandID>& ignored
+) {
+    aabb.fix();
+    minSpacing = std::max(minSpacing, 0);
+    if (!includeY) {
+        aabb.min.y = AnyYMin;
+        aabb.max.y = AnyYMax;
+    }
+    auto spacingY = includeY ? minSpacing : 0;
+    auto lower    = BlockPos{aabb.min.x - minSpacing, aabb.min.y - spacingY, aabb.min.z - minSpacing};
+    auto upper    = BlockPos{aabb.max.x + minSpacing, aabb.max.y + spacingY, aabb.max.z + minSpacing};
+
+    std::sort(ignored.begin(), ignored.end());
+    std::vector<std::pair<land::LandID, LandConflictType>> result;
+    for (auto& land : land::PLand::getInstance().getLandRegistry().getLandAt(lower, upper, dimid)) {
+        auto id = land->getId();
+        if (std::binary_search(ignored.begin(), ignored.end(), id)) {
+            continue;
+        }
+        auto other = land->getAABB();
+        if (!includeY) {
+            other.min.y = AnyYMin;
+            other.max.y = AnyYMax;
+        }
+        if (land::LandAABB::isContain(aabb, other) || land::LandAABB::isContain(other, aabb)) {
+            result.emplace_back(id, LandConflictType::Containment);
+        } else if (land::LandAABB::isCollision(aabb, other)) {
+            result.emplace_back(id, LandConflictType::Overlap);
+        } else if (!land::LandAABB::isComplisWithMinSpacing(aabb, other, minSpacing, includeY)) {
+            result.emplace_back(id, LandConflictType::Spacing);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+
 void Export_Class_LandRegistry() {
+    LandChangeFeed::getInstance(); // 从加载时开始记录变更
+
     exportAs("LandRegistry_createSnapshot", [](std::string const& dirName) -> void {
         std::optional<std::string> finalName{std::nullopt};
         if (!dirName.empty()) finalName = dirName;
@@ -27,24 +89,27 @@ void Export_Class_LandRegistry() {
     });
 
     exportAs("LandRegistry_isOperator", [](std::string const& uuid) -> bool {
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return false;
         }
-        return land::PLand::getInstance().getLandRegistry().isOperator(mce::UUID{uuid});
+        return land::PLand::getInstance().getLandRegistry().isOperator(*parsed);
     });
 
     exportAs("LandRegistry_addOperator", [](std::string const& uuid) -> bool {
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return false;
         }
-        return land::PLand::getInstance().getLandRegistry().addOperator(mce::UUID{uuid});
+        return land::PLand::getInstance().getLandRegistry().addOperator(*parsed);
     });
 
     exportAs("LandRegistry_removeOperator", [](std::string const& uuid) -> bool {
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return false;
         }
-        return land::PLand::getInstance().getLandRegistry().removeOperator(mce::UUID{uuid});
+        return land::PLand::getInstance().getLandRegistry().removeOperator(*parsed);
     });
 
     exportAs("LandRegistry_getOperators", []() -> std::vector<std::string> {
@@ -53,12 +118,13 @@ void Export_Class_LandRegistry() {
     });
 
     exportAs("LandRegistry_getOrCreatePlayerSettings", [](std::string const& uuid) -> std::string {
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return {};
         }
         try {
             // struct -> json -> std::string
-            auto& settings = land::PLand::getInstance().getLandRegistry().getOrCreatePlayerSettings(mce::UUID{uuid});
+            auto& settings = land::PLand::getInstance().getLandRegistry().getOrCreatePlayerSettings(*parsed);
 
 #ifndef PLAND_BUILD_MODE
             auto j = land::json_util::struct2json(settings); // <= v0.21.x
@@ -71,115 +137,104 @@ void Export_Class_LandRegistry() {
         }
     });
 
-    exportAs("LandRegistry_hasLand", [](int id) -> bool {
-        return land::PLand::getInstance().getLandRegistry().hasLand(id);
-    });
+    // 领地参数均为 LandRef (LandID 或 Land_getHandle 返回的句柄)
+    exportAs("LandRegistry_hasLand", [](LandRef id) -> bool { return resolveLand(id) != nullptr; });
 
-    exportAs(
+    exportFfi(
         "LandRegistry_addOrdinaryLand",
-        [](InternalLandAABB iaabb, bool is3D, std::string const& owner) -> FfiProtocol {
+        [](InternalLandAABB iaabb, bool is3D, std::string const& owner) -> FfiResult<land::LandID> {
             if (iaabb[0].second != iaabb[1].second) {
                 return ffi_error("LandRegistry_addOrdinaryLand: Invalid AABB, different dimensions");
             }
-            if (!mce::UUID::canParse(owner)) {
+            auto parsed = parseUUID(owner);
+            if (!parsed) {
                 return ffi_error("LandRegistry_addOrdinaryLand: Invalid owner");
             }
             auto dimId = iaabb[0].second;
             auto aabb  = toCpp<land::LandAABB>(iaabb);
             aabb.fix();
 
-            auto land     = land::Land::make(aabb, dimId, is3D, mce::UUID{owner});
+            auto land     = land::Land::make(aabb, dimId, is3D, *parsed);
             auto expected = land::PLand::getInstance().getLandRegistry().addOrdinaryLand(land);
-            return as_ffi_protocol(expected, [land](auto&) { return land->getId(); });
+            if (expected) {
+                LandObserver::getInstance().notify({land->getId(), LandChangeKind::Created});
+            }
+            return as_ffi_result(expected, [land]() { return land->getId(); });
         }
     );
 
-    exportAs("LandRegistry_getLand", [](int id) -> int {
-        auto land = land::PLand::getInstance().getLandRegistry().getLand(id);
-        if (!land) return -1;
+    exportAs("LandRegistry_getLand", [](LandRef id) -> land::LandID {
+        auto land = resolveLand(id);
+        if (!land) return land::INVALID_LAND_ID;
         return land->getId();
     });
 
-    exportAs("LandRegistry_removeOrdinaryLand", [](int id) -> FfiProtocol {
-        auto ptr    = land::PLand::getInstance().getLandRegistry().getLand(id);
+    exportFfi("LandRegistry_removeOrdinaryLand", [](LandRef id) -> FfiResult<> {
+        auto ptr    = resolveLand(id);
         auto result = land::PLand::getInstance().getLandRegistry().removeOrdinaryLand(ptr);
-        return as_ffi_protocol(result);
+        if (result) {
+            LandObserver::getInstance().notify({ptr->getId(), LandChangeKind::Removed});
+        }
+        return as_ffi_result(result);
     });
 
     using LandList = std::vector<land::LandID>;
-    exportAs("LandRegistry_getLands", []() -> LandList {
-        auto     lands = land::PLand::getInstance().getLandRegistry().getLands();
-        LandList result;
-        result.reserve(lands.size());
-        std::transform(lands.begin(), lands.end(), std::back_inserter(result), [](auto& land) {
-            return land->getId();
-        });
-        return result;
-    });
+    // 以下两个查询直接返回随领地增删维护的 ID 列表 (按 ID 升序)
+    exportAs("LandRegistry_getLands", []() -> LandList { return LandListCache::getInstance().getAll(); });
 
     exportAs("LandRegistry_getLands1", [](int dimid) -> LandList {
-        auto     lands = land::PLand::getInstance().getLandRegistry().getLands(dimid);
-        LandList result;
-        result.reserve(lands.size());
-        std::transform(lands.begin(), lands.end(), std::back_inserter(result), [](auto& land) {
-            return land->getId();
-        });
-        return result;
+        return LandListCache::getInstance().getByDimension(static_cast<land::LandDimid>(dimid));
+    });
+
+    // 领地增删 / 范围变化时递增，未变化时脚本可跳过 getLands / getLands1 (只用于判等)
+    exportAs("LandRegistry_getGeneration", []() -> int64_t {
+        return static_cast<int64_t>(LandListCache::getInstance().getGeneration());
     });
 
+    // 由反向索引提供，不遍历注册表
     exportAs("LandRegistry_getLands2", [](std::string const& uuid, bool includeShared) -> LandList {
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return {};
         }
-        auto     lands = land::PLand::getInstance().getLandRegistry().getLands(mce::UUID{uuid}, includeShared);
-        LandList result;
-        result.reserve(lands.size());
-        std::transform(lands.begin(), lands.end(), std::back_inserter(result), [](auto& land) {
-            return land->getId();
-        });
-        return result;
+        return OwnerIndex::getInstance().getLands(*parsed, includeShared);
     });
 
     exportAs("LandRegistry_getLands3", [](std::string const& uuid, int dimid) -> LandList {
-        if (!mce::UUID::canParse(uuid)) {
+        auto parsed = parseUUID(uuid);
+        if (!parsed) {
             return {};
         }
-        auto     lands = land::PLand::getInstance().getLandRegistry().getLands(mce::UUID{uuid}, dimid);
-        LandList result;
-        result.reserve(lands.size());
-        std::transform(lands.begin(), lands.end(), std::back_inserter(result), [](auto& land) {
-            return land->getId();
-        });
-        return result;
+        return OwnerIndex::getInstance().getLands(*parsed, static_cast<land::LandDimid>(dimid));
     });
 
-    exportAs("LandRegistry_getLands4", [](std::vector<int> lds) -> LandList {
-        LandList int64List;
-        int64List.reserve(lds.size());
-        std::transform(lds.begin(), lds.end(), std::back_inserter(int64List), [](int i) {
-            return static_cast<land::LandID>(i);
-        });
-
-        auto lands = land::PLand::getInstance().getLandRegistry().getLands(int64List);
-
+    exportAs("LandRegistry_getLands4", [](std::vector<LandRef> refs) -> LandList {
         LandList result;
-        result.reserve(lands.size());
-        std::transform(lands.begin(), lands.end(), std::back_inserter(result), [](auto& land) {
-            return land->getId();
-        });
-
+        result.reserve(refs.size());
+        for (auto ref : refs) {
+            if (auto land = resolveLand(ref)) {
+                result.push_back(land->getId());
+            }
+        }
         return result;
     });
 
-    exportAs("LandRegistry_getPermType", [](std::string const& uuid, int landID, bool includeOperator) {
-        return static_cast<int>(land::PLand::getInstance()
-                                    .getLandRegistry()
-                                    .getPermType(mce::UUID{uuid}, static_cast<land::LandID>(landID), includeOperator));
+    // 领地或句柄无效时返回 -1 (与 Land_getPermType 一致)
+    exportAs("LandRegistry_getPermType", [](std::string const& uuid, LandRef landID, bool includeOperator) -> int {
+        auto land = resolveLand(landID);
+        if (!land) {
+            return land::INVALID_LAND_ID;
+        }
+        return static_cast<int>(land::PLand::getInstance().getLandRegistry().getPermType(
+            parseUUID(uuid).value_or(mce::UUID{}),
+            land->getId(),
+            includeOperator
+        ));
     });
 
-    exportAs("LandRegistry_getLandAt", [](IntPos pos) -> int {
+    exportAs("LandRegistry_getLandAt", [](IntPos pos) -> land::LandID {
         auto land = land::PLand::getInstance().getLandRegistry().getLandAt(pos.first, pos.second);
-        if (!land) return -1;
+        if (!land) return land::INVALID_LAND_ID;
         return land->getId();
     });
 
@@ -203,10 +258,79 @@ void Export_Class_LandRegistry() {
         return result;
     });
 
-    exportAs("LandRegistry_refreshLandRange", [](int id) -> void {
+    // [id0, type0, id1, type1, ...]，type 为 LandConflictType，按领地 ID 升序
+    exportAs(
+        "LandRegistry_findConflicts",
+        [](IntPos a, IntPos b, int minSpacing, bool includeY, std::vector<LandRef> ignoreIds) -> std::vector<int64_t> {
+            std::vector<land::LandID> ignored;
+            ignored.reserve(ignoreIds.size());
+            for (auto ref : ignoreIds) {
+                if (auto land = resolveLand(ref)) {
+                    ignored.push_back(land->getId());
+                }
+            }
+            auto aabb      = land::LandAABB::make(land::LandPos::make(a.first), land::LandPos::make(b.first));
+            auto conflicts = findConflicts(aabb, a.second, minSpacing, includeY, ignored);
+
+            std::vector<int64_t> result;
+            result.reserve(conflicts.size() * 2);
+            for (auto& [id, type] : conflicts) {
+                result.push_back(static_cast<int64_t>(id));
+                result.push_back(static_cast<int64_t>(type));
+            }
+            return result;
+        }
+    );
+
+    exportAs("LandRegistry_refreshLandRange", [](LandRef id) -> void {
         auto& inst = land::PLand::getInstance().getLandRegistry();
-        auto  land = inst.getLand(id);
-        if (land) inst.refreshLandRange(land);
+        auto  land = resolveLand(id);
+        if (land) {
+            inst.refreshLandRange(land);
+            LandObserver::getInstance().notify({land->getId(), LandChangeKind::Resized});
+        }
+    });
+
+    // 变更日志: [version, resync, id0, mask0, id1, mask1, ...]
+    // mask 为变更类型的位掩码 (1 << LandChangeKind)，resync 为 1 时需要全量同步 (此时没有领地条目)
+    exportAs("LandRegistry_changesSince", [](int64_t version) -> std::vector<int64_t> {
+        auto                 changes = LandChangeFeed::getInstance().changesSince(version);
+        std::vector<int64_t> result;
+        result.reserve(2 + changes.lands.size() * 2);
+        result.push_back(changes.version);
+        result.push_back(changes.resync ? 1 : 0);
+        for (auto& [id, mask] : changes.lands) {
+            result.push_back(static_cast<int64_t>(id));
+            result.push_back(static_cast<int64_t>(mask));
+        }
+        return result;
+    });
+
+    // 校验模式: 反向索引的每次查询都与注册表比对 (全表遍历，仅用于排查)
+    exportAs("LandRegistry_setOwnerIndexCrossCheck", [](bool enabled) -> void {
+        OwnerIndex::getInstance().setCrossCheck(enabled);
+    });
+
+    // 校验模式: 领地列表缓存的每次读取都抽查少量 ID (仅用于排查漏掉的变更通知)
+    exportAs("LandRegistry_setLandListCrossCheck", [](bool enabled) -> void {
+        LandListCache::getInstance().setCrossCheck(enabled);
+    });
+
+    // 校验模式下发现漏掉通知并重建的次数
+    exportAs("LandRegistry_getLandListMismatches", []() -> int64_t {
+        return static_cast<int64_t>(LandListCache::getInstance().getMismatches());
+    });
+
+    // [queries, mismatches, players, lands, stale]
+    exportAs("LandRegistry_getOwnerIndexStats", []() -> std::vector<int64_t> {
+        auto stats = OwnerIndex::getInstance().getStats();
+        return {
+            static_cast<int64_t>(stats.queries),
+            static_cast<int64_t>(stats.mismatches),
+            static_cast<int64_t>(stats.players),
+            static_cast<int64_t>(stats.lands),
+            static_cast<int64_t>(stats.stale)
+        };
     });
 
     exportAs("PLand_getVersionMeta", []() -> std::string {
@@ -4,78 +4,99 @@
 #include <pland/service/ServiceLocator.h>
 #include <pland/utils/TimeUtils.h>
 
+#include <vector>
+
 #include "APIHelper.h"
 #include "ExportDef.h"
+#include "LandHandles.h"
+#include "LandObserver.h"
 
 namespace ldapi {
 
+// 回收会从注册表删除领地，调用前后比对，确保缓存 / 索引收到删除通知 (不依赖 LandRecycleEvent 的触发时机)
+static void notifyRemoved(std::vector<land::LandID> const& before) {
+    auto& registry = land::PLand::getInstance().getLandRegistry();
+    for (auto id : before) {
+        if (!registry.hasLand(id)) {
+            LandObserver::getInstance().notify({id, LandChangeKind::Removed});
+        }
+    }
+}
+
 void export_LeasingService() {
-    auto& mod      = land::PLand::getInstance();
-    auto  registry = &mod.getLandRegistry();
-    auto  service  = &mod.getServiceLocator().getLeasingService();
+    auto& mod     = land::PLand::getInstance();
+    auto  service = &mod.getServiceLocator().getLeasingService();
 
     exportAs("LeasingService_enabled", [service]() -> bool { return service->enabled(); });
 
-    exportAs("LeasingService_refreshSchedule", [service, registry](int landId) -> void {
-        if (auto land = registry->getLand(landId)) {
+    exportAs("LeasingService_refreshSchedule", [service](LandRef landId) -> void {
+        if (auto land = resolveLand(landId)) {
             service->refreshSchedule(land);
         }
     });
 
-    exportAs("LeasingService_setStartAt", [service, registry](int landId, std::string const& timestamp) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
+    exportFfi("LeasingService_setStartAt", [service](LandRef landId, std::string const& timestamp) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
             auto ts = land::time_utils::parseTime(timestamp);
             if (ts == std::chrono::system_clock::time_point{}) {
                 return ffi_error("invalid timestamp [{}]", timestamp);
             }
-            return as_ffi_protocol(service->setStartAt(land, ts));
+            return as_ffi_result(service->setStartAt(land, ts));
         }
         return ffi_error("land [{}] not found", landId);
     });
-    exportAs("LeasingService_setStartAt", [service, registry](int landId, std::string const& timestamp) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
+    exportFfi("LeasingService_setEndAt", [service](LandRef landId, std::string const& timestamp) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
             auto ts = land::time_utils::parseTime(timestamp);
             if (ts == std::chrono::system_clock::time_point{}) {
                 return ffi_error("invalid timestamp [{}]", timestamp);
             }
-            return as_ffi_protocol(service->setEndAt(land, ts));
+            return as_ffi_result(service->setEndAt(land, ts));
         }
         return ffi_error("land [{}] not found", landId);
     });
 
-    exportAs("LeasingService_forceFreeze", [service, registry](int landId) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
-            return as_ffi_protocol(service->forceFreeze(land));
+    exportFfi("LeasingService_forceFreeze", [service](LandRef landId) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
+            return as_ffi_result(service->forceFreeze(land));
         }
         return ffi_error("land [{}] not found", landId);
     });
-    exportAs("LeasingService_forceRecycle", [service, registry](int landId) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
-            return as_ffi_protocol(service->forceRecycle(land));
+    exportFfi("LeasingService_forceRecycle", [service](LandRef landId) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
+            auto result = service->forceRecycle(land);
+            notifyRemoved({land->getId()});
+            return as_ffi_result(result);
         }
         return ffi_error("land [{}] not found", landId);
     });
 
-    exportAs("LeasingService_addTime", [service, registry](int landId, int sec) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
-            return as_ffi_protocol(service->addTime(land, sec));
+    exportFfi("LeasingService_addTime", [service](LandRef landId, int sec) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
+            return as_ffi_result(service->addTime(land, sec));
         }
         return ffi_error("land [{}] not found", landId);
     });
 
-    exportAs("LeasingService_cleanExpiredLands", [service](int daysOverdue) -> FfiProtocol {
-        return as_ffi_protocol(service->cleanExpiredLands(daysOverdue));
+    exportFfi("LeasingService_cleanExpiredLands", [service](int daysOverdue) {
+        std::vector<land::LandID> before;
+        for (auto& land : land::PLand::getInstance().getLandRegistry().getLands()) {
+            before.push_back(land->getId());
+        }
+        auto result = service->cleanExpiredLands(daysOverdue);
+        notifyRemoved(before);
+        return as_ffi_result(result);
     });
 
-    exportAs("LeasingService_toBought", [service, registry](int landId) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
-            return as_ffi_protocol(service->toBought(land));
+    exportFfi("LeasingService_toBought", [service](LandRef landId) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
+            return as_ffi_result(service->toBought(land));
         }
         return ffi_error("land [{}] not found", landId);
     });
-    exportAs("LeasingService_toLeased", [service, registry](int landId, int days) -> FfiProtocol {
-        if (auto land = registry->getLand(landId)) {
-            return as_ffi_protocol(service->toLeased(land, days));
+    exportFfi("LeasingService_toLeased", [service](LandRef landId, int days) -> FfiResult<> {
+        if (auto land = resolveLand(landId)) {
+            return as_ffi_result(service->toLeased(land, days));
         }
         return ffi_error("land [{}] not found", landId);
     });
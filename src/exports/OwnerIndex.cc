@@ -0,0 +1,221 @@
+#include "exports/OwnerIndex.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include <algorithm>
+
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+
+OwnerIndex::OwnerIndex() {
+    LandObserver::getInstance().subscribe([this](LandChange const& change) {
+        if (!mBuilt) {
+            return; // 尚未构建，首次查询时会全量构建
+        }
+        switch (change.kind) {
+        case LandChangeKind::Removed:
+            erase(change.id);
+            break;
+        case LandChangeKind::Created:
+        case LandChangeKind::OwnerChanged:
+        case LandChangeKind::MembersChanged:
+            update(change.id);
+            break;
+        case LandChangeKind::Resized:
+        case LandChangeKind::StateChanged:
+            break;
+        }
+    });
+}
+
+void OwnerIndex::ensureBuilt() {
+    if (!mBuilt) {
+        rebuild();
+    }
+}
+
+void OwnerIndex::rebuild() {
+    mLands.clear();
+    mPlayers.clear();
+    for (auto& land : land::PLand::getInstance().getLandRegistry().getLands()) {
+        insert(*land);
+    }
+    mBuilt = true;
+}
+
+// 以领地当前的主人 / 成员为准重新登记 (同一变更被事件与导出接口各通知一次也不会重复)
+void OwnerIndex::update(land::LandID id) {
+    erase(id);
+    if (auto land = land::PLand::getInstance().getLandRegistry().getLand(id)) {
+        insert(*land);
+    }
+}
+
+void OwnerIndex::insert(land::Land const& land) {
+    auto  id    = land.getId();
+    auto& entry = mLands[id];
+    entry.owner = land.getOwner();
+    entry.dimid = land.getDimensionId();
+    entry.members.clear();
+
+    auto& owned = mPlayers[entry.owner].owned;
+    auto  group = std::find_if(owned.begin(), owned.end(), [&](DimLands const& g) { return g.dimid == entry.dimid; });
+    if (group == owned.end()) {
+        group = owned.insert(owned.end(), DimLands{entry.dimid, {}});
+    }
+    group->ids.push_back(id);
+
+    for (auto& member : land.getMembers()) {
+        auto duplicated = std::find(entry.members.begin(), entry.members.end(), member) != entry.members.end();
+        if (member == entry.owner || duplicated) {
+            continue;
+        }
+        entry.members.push_back(member);
+        mPlayers[member].shared.push_back(id);
+    }
+}
+
+void OwnerIndex::erase(land::LandID id) {
+    auto iter = mLands.find(id);
+    if (iter == mLands.end()) {
+        return;
+    }
+    auto& entry = iter->second;
+
+    // 顺序无关，交换到末尾删除
+    auto removeId = [id](LandList& ids) {
+        if (auto pos = std::find(ids.begin(), ids.end(), id); pos != ids.end()) {
+            *pos = ids.back();
+            ids.pop_back();
+        }
+    };
+    auto dropIfEmpty = [this](std::unordered_map<mce::UUID, PlayerEntry>::iterator player) {
+        if (player->second.owned.empty() && player->second.shared.empty()) {
+            mPlayers.erase(player);
+        }
+    };
+
+    if (auto player = mPlayers.find(entry.owner); player != mPlayers.end()) {
+        auto& owned = player->second.owned;
+        for (auto group = owned.begin(); group != owned.end(); ++group) {
+            if (group->dimid == entry.dimid) {
+                removeId(group->ids);
+                if (group->ids.empty()) {
+                    owned.erase(group);
+                }
+                break;
+            }
+        }
+        dropIfEmpty(player);
+    }
+    for (auto& member : entry.members) {
+        if (auto player = mPlayers.find(member); player != mPlayers.end()) {
+            removeId(player->second.shared);
+            dropIfEmpty(player);
+        }
+    }
+    mLands.erase(iter);
+}
+
+template <typename Pred>
+void OwnerIndex::dropStale(LandList& result, Pred&& matches) {
+    auto&    registry = land::PLand::getInstance().getLandRegistry();
+    LandList stale;
+    std::erase_if(result, [&](land::LandID id) {
+        auto land = registry.getLand(id);
+        if (land && matches(*land)) {
+            return false;
+        }
+        stale.push_back(id);
+        return true;
+    });
+    // 说明漏掉了变更通知，以注册表为准重新登记 (删除的领地会被移除)
+    mStale += stale.size();
+    for (auto id : stale) {
+        update(id);
+    }
+}
+
+OwnerIndex::LandList OwnerIndex::verify(LandList result, LandList expected) {
+    auto sortedResult = result;
+    std::sort(sortedResult.begin(), sortedResult.end());
+    std::sort(expected.begin(), expected.end());
+    if (sortedResult == expected) {
+        return result;
+    }
+    ++mMismatches;
+    rebuild();
+    return expected;
+}
+
+template <typename Lands>
+static OwnerIndex::LandList toIds(Lands const& lands) {
+    OwnerIndex::LandList ids;
+    ids.reserve(lands.size());
+    for (auto& land : lands) {
+        ids.push_back(land->getId());
+    }
+    return ids;
+}
+
+OwnerIndex::LandList OwnerIndex::getLands(mce::UUID const& uuid, bool includeShared) {
+    ensureBuilt();
+    ++mQueries;
+
+    LandList result;
+    if (auto iter = mPlayers.find(uuid); iter != mPlayers.end()) {
+        auto& player = iter->second;
+        auto  count  = includeShared ? player.shared.size() : 0;
+        for (auto& group : player.owned) {
+            count += group.ids.size();
+        }
+        result.reserve(count);
+        for (auto& group : player.owned) {
+            result.insert(result.end(), group.ids.begin(), group.ids.end());
+        }
+        if (includeShared) {
+            result.insert(result.end(), player.shared.begin(), player.shared.end());
+        }
+    }
+    dropStale(result, [&](land::Land const& land) {
+        return land.isOwner(uuid) || (includeShared && land.isMember(uuid));
+    });
+    if (mCrossCheck) {
+        auto& registry = land::PLand::getInstance().getLandRegistry();
+        return verify(std::move(result), toIds(registry.getLands(uuid, includeShared)));
+    }
+    return result;
+}
+
+OwnerIndex::LandList OwnerIndex::getLands(mce::UUID const& uuid, land::LandDimid dimid) {
+    ensureBuilt();
+    ++mQueries;
+
+    LandList result;
+    if (auto iter = mPlayers.find(uuid); iter != mPlayers.end()) {
+        for (auto& group : iter->second.owned) {
+            if (group.dimid == dimid) {
+                result = group.ids;
+                break;
+            }
+        }
+    }
+    dropStale(result, [&](land::Land const& land) { return land.isOwner(uuid) && land.getDimensionId() == dimid; });
+    if (mCrossCheck) {
+        auto& registry = land::PLand::getInstance().getLandRegistry();
+        return verify(std::move(result), toIds(registry.getLands(uuid, dimid)));
+    }
+    return result;
+}
+
+OwnerIndex& OwnerIndex::getInstance() {
+    static OwnerIndex instance;
+    return instance;
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,90 @@
+#pragma once
+#include "mc/platform/UUID.h"
+
+#include "pland/Global.h"
+#include "pland/land/Land.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+namespace ldapi {
+
+
+/**
+ * 玩家 UUID -> 领地 ID 的反向索引 (主人按维度分组，成员单独一组)
+ * 首次查询时从注册表全量构建，之后由 LandObserver 的变更通知逐块领地增量维护
+ * 每次查询都按 ID 回查注册表 (O(结果数))，丢弃已删除 / 主人或成员已变化的条目并重新登记这些领地
+ * 回查只能发现结果中多出的领地，漏掉的新增 / 转入 (不在索引中的领地) 只有校验模式能发现:
+ * 校验模式下每次查询还与注册表的全表遍历结果比对，不一致时以注册表为准并重建索引
+ */
+class OwnerIndex {
+public:
+    using LandList = std::vector<land::LandID>;
+
+    struct Stats {
+        uint64_t queries;
+        uint64_t mismatches;
+        size_t   players;
+        size_t   lands;
+        uint64_t stale; // 查询时回查注册表发现的失效条目
+    };
+
+    /// 玩家拥有的领地，includeShared 时包含作为成员的领地
+    LandList getLands(mce::UUID const& uuid, bool includeShared);
+
+    /// 玩家在指定维度拥有的领地
+    LandList getLands(mce::UUID const& uuid, land::LandDimid dimid);
+
+    void setCrossCheck(bool enabled) { mCrossCheck = enabled; }
+
+    [[nodiscard]] bool isCrossCheck() const { return mCrossCheck; }
+
+    [[nodiscard]] Stats getStats() const {
+        return {mQueries, mMismatches, mPlayers.size(), mLands.size(), mStale};
+    }
+
+    static OwnerIndex& getInstance();
+
+private:
+    OwnerIndex();
+
+    struct LandEntry {
+        mce::UUID              owner;
+        land::LandDimid        dimid;
+        std::vector<mce::UUID> members; // 不含主人自身
+    };
+    struct DimLands {
+        land::LandDimid dimid;
+        LandList        ids;
+    };
+    struct PlayerEntry {
+        std::vector<DimLands> owned;
+        LandList              shared;
+    };
+
+    void ensureBuilt();
+    void rebuild();
+    void update(land::LandID id);
+    void insert(land::Land const& land);
+    void erase(land::LandID id);
+
+    /// 回查注册表，移除不满足 matches 的 ID 并重新登记对应领地 (不能发现索引中缺失的领地)
+    template <typename Pred>
+    void dropStale(LandList& result, Pred&& matches);
+
+    /// 校验模式: 与注册表的结果比对，不一致时返回注册表的结果
+    LandList verify(LandList result, LandList expected);
+
+    bool                                        mBuilt{false};
+    bool                                        mCrossCheck{false};
+    uint64_t                                    mQueries{0};
+    uint64_t                                    mMismatches{0};
+    uint64_t                                    mStale{0};
+    std::unordered_map<land::LandID, LandEntry> mLands;
+    std::unordered_map<mce::UUID, PlayerEntry>  mPlayers;
+};
+
+
+} // namespace ldapi
@@ -0,0 +1,62 @@
+#include "exports/PermCache.h"
+
+#include <cstring>
+#include <type_traits>
+
+#include "exports/APIHelper.h"
+#include "exports/LandObserver.h"
+
+
+namespace ldapi {
+
+
+static_assert(std::is_trivially_copyable_v<land::LandPermTable>, "LandPermTable must stay a plain flag table");
+
+PermTableCache::PermTableCache() {
+    LandObserver::getInstance().subscribe([this](LandChange const& change) {
+        if (change.kind == LandChangeKind::Removed) {
+            erase(change.id);
+        }
+    });
+}
+
+std::string const& PermTableCache::getSerialized(land::Land const& land) {
+    auto& table = land.getPermTable();
+    auto  iter  = mEntries.find(land.getId());
+    if (iter != mEntries.end()) {
+        auto& entry = iter->second;
+        mLru.splice(mLru.begin(), mLru, entry.lru);
+        // memcmp 远快于反射序列化
+        if (std::memcmp(&entry.table, &table, sizeof(table)) == 0) {
+            ++mHits;
+            return entry.serialized;
+        }
+    } else {
+        if (mEntries.size() >= MaxEntries) {
+            erase(mLru.back());
+        }
+        mLru.push_front(land.getId());
+        iter             = mEntries.try_emplace(land.getId()).first;
+        iter->second.lru = mLru.begin();
+    }
+    ++mMisses;
+    auto& entry      = iter->second;
+    entry.table      = table;
+    entry.serialized = toLSE<land::LandPermTable>(table);
+    return entry.serialized;
+}
+
+void PermTableCache::erase(land::LandID id) {
+    if (auto iter = mEntries.find(id); iter != mEntries.end()) {
+        mLru.erase(iter->second.lru);
+        mEntries.erase(iter);
+    }
+}
+
+PermTableCache& PermTableCache::getInstance() {
+    static PermTableCache instance;
+    return instance;
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,53 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/land/Land.h"
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+
+namespace ldapi {
+
+
+/**
+ * 按领地缓存序列化后的权限表，超出容量时淘汰最久未使用的领地
+ * PLand 自身的 GUI 修改权限时不经过导出接口，命中时比对缓存时的权限表内容来发现修改
+ */
+class PermTableCache {
+public:
+    static constexpr size_t MaxEntries = 4096;
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        size_t   entries;
+    };
+
+    /// 获取序列化的权限表，命中时不进行任何反射 / 序列化
+    std::string const& getSerialized(land::Land const& land);
+
+    [[nodiscard]] Stats getStats() const { return {mHits, mMisses, mEntries.size()}; }
+
+    static PermTableCache& getInstance();
+
+private:
+    PermTableCache();
+
+    struct Entry {
+        land::LandPermTable               table{}; // 缓存时的权限表
+        std::string                       serialized;
+        std::list<land::LandID>::iterator lru;
+    };
+
+    void erase(land::LandID id);
+
+    uint64_t                                mHits{0};
+    uint64_t                                mMisses{0};
+    std::list<land::LandID>                 mLru; // 最近使用的在前
+    std::unordered_map<land::LandID, Entry> mEntries;
+};
+
+
+} // namespace ldapi
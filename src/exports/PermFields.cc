@@ -0,0 +1,73 @@
+#include "exports/PermFields.h"
+
+#include "ll/api/reflection/Reflection.h"
+
+#include <type_traits>
+
+
+namespace ldapi {
+
+
+PermFieldTable::PermFieldTable() {
+    land::LandPermTable probe{};
+    auto const*         base = reinterpret_cast<std::byte const*>(&probe);
+
+    auto addField = [&](bool const& member, std::string_view name, std::string_view role) {
+        auto offset = static_cast<size_t>(reinterpret_cast<std::byte const*>(&member) - base);
+        mIndex.emplace(makeKey(name, role), mFields.size());
+        mFields.push_back({mFields.size(), offset, std::string{name}, std::string{role}});
+    };
+
+    // LandPermTable { environment: { allowXxx: bool }, role: { allowXxx: { member: bool, actor: bool } } }
+    ll::reflection::forEachMember(probe, [&](std::string_view, auto& group) {
+        ll::reflection::forEachMember(group, [&](std::string_view name, auto& member) {
+            using M = std::remove_cvref_t<decltype(member)>;
+            if constexpr (std::is_same_v<M, bool>) {
+                addField(member, name, {});
+            } else {
+                ll::reflection::forEachMember(member, [&](std::string_view role, auto& flag) {
+                    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(flag)>, bool>) {
+                        addField(flag, name, role);
+                    }
+                });
+            }
+        });
+    });
+}
+
+std::string PermFieldTable::makeKey(std::string_view name, std::string_view role) {
+    std::string key{name};
+    if (!role.empty()) {
+        key += '.';
+        key += role;
+    }
+    return key;
+}
+
+PermField const* PermFieldTable::resolve(std::string_view name, std::string_view role) const {
+    auto iter = mIndex.find(makeKey(name, role));
+    if (iter == mIndex.end()) {
+        return nullptr;
+    }
+    return &mFields[iter->second];
+}
+
+PermFieldGroup PermFieldTable::resolveGroup(std::string_view name) const {
+    return {resolve(name, {}), resolve(name, "member"), resolve(name, "actor")};
+}
+
+bool PermFieldTable::get(land::LandPermTable const& table, PermField const& field) {
+    return *reinterpret_cast<bool const*>(reinterpret_cast<std::byte const*>(&table) + field.offset);
+}
+
+void PermFieldTable::set(land::LandPermTable& table, PermField const& field, bool value) {
+    *reinterpret_cast<bool*>(reinterpret_cast<std::byte*>(&table) + field.offset) = value;
+}
+
+PermFieldTable const& PermFieldTable::getInstance() {
+    static PermFieldTable instance;
+    return instance;
+}
+
+
+} // namespace ldapi
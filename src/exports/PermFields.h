@@ -0,0 +1,67 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/land/LandPermTable.h"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+namespace ldapi {
+
+
+/**
+ * 权限表中的单个标志位
+ * 环境权限: name = "allowFireSpread", role = ""
+ * 角色权限: name = "allowPvP", role = "member" / "actor"
+ */
+struct PermField {
+    size_t      index;  // 在 PermFieldTable 中的序号
+    size_t      offset; // 相对 LandPermTable 的字节偏移
+    std::string name;
+    std::string role;
+};
+
+/**
+ * 按名称解析出的一组权限标志
+ * 环境权限只有 flag，角色权限同时有 member / actor
+ */
+struct PermFieldGroup {
+    PermField const* flag{nullptr};
+    PermField const* member{nullptr};
+    PermField const* actor{nullptr};
+
+    [[nodiscard]] bool isValid() const { return flag || (member && actor); }
+};
+
+/**
+ * 权限字段名 -> 偏移 的映射，通过 LandPermTable 的反射信息构建一次
+ * 单个标志的读写只需一次哈希查找与一次内存访问，无需 JSON 往返
+ */
+class PermFieldTable {
+public:
+    [[nodiscard]] PermField const* resolve(std::string_view name, std::string_view role) const;
+
+    [[nodiscard]] PermFieldGroup resolveGroup(std::string_view name) const;
+
+    [[nodiscard]] std::vector<PermField> const& getFields() const { return mFields; }
+
+    static bool get(land::LandPermTable const& table, PermField const& field);
+    static void set(land::LandPermTable& table, PermField const& field, bool value);
+
+    static PermFieldTable const& getInstance();
+
+private:
+    PermFieldTable();
+
+    static std::string makeKey(std::string_view name, std::string_view role);
+
+    std::vector<PermField>                  mFields;
+    std::unordered_map<std::string, size_t> mIndex; // "name" 或 "name.role" -> mFields 下标
+};
+
+
+} // namespace ldapi
@@ -0,0 +1,129 @@
+#include "exports/TraceRecorder.h"
+#include "ExportDef.h"
+#include "exports/APIHelper.h"
+
+#include "fmt/format.h"
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+
+namespace ldapi {
+
+
+uint32_t TraceRecorder::intern(std::string name, char const* category) {
+    std::lock_guard lock{mNamesMutex};
+    auto [iter, inserted] = mNameIds.try_emplace(fmt::format("{}/{}", category, name), 0);
+    if (inserted) {
+        iter->second = static_cast<uint32_t>(mNames.size());
+        mNames.push_back({std::move(name), category});
+    }
+    return iter->second;
+}
+
+bool TraceRecorder::start(size_t capacity) {
+    if (!InstrumentationEnabled || isRecording()) {
+        return false;
+    }
+    // 容量不变时沿用上次的缓冲，mNext 归零后旧记录不会被读出
+    auto size = std::clamp<size_t>(capacity, 1, MaxCapacity);
+    if (mEvents.size() != size) {
+        mEvents.assign(size, Event{});
+    }
+    mNext.store(0, std::memory_order_relaxed);
+    mStartedAt = std::chrono::steady_clock::now();
+    mRecording.store(true, std::memory_order_release);
+    return true;
+}
+
+std::optional<size_t> TraceRecorder::stop(std::filesystem::path const& path) {
+    if (!mRecording.exchange(false, std::memory_order_acquire)) {
+        return std::nullopt;
+    }
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    if (!file) {
+        return std::nullopt;
+    }
+
+    auto total = mNext.load(std::memory_order_relaxed);
+    auto count = std::min<uint64_t>(total, mEvents.size());
+    auto first = total - count; // 环形缓冲中最旧的一条
+
+    std::vector<std::string> names; // JSON 转义后的名称
+    std::vector<std::string> categories;
+    {
+        std::lock_guard lock{mNamesMutex};
+        for (auto& name : mNames) {
+            names.push_back(nlohmann::json(name.name).dump());
+            categories.push_back(nlohmann::json(name.category).dump());
+        }
+    }
+
+    auto toMicros = [](std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    };
+
+    auto out = std::ostreambuf_iterator<char>{file};
+    fmt::format_to(out, "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (uint64_t i = 0; i < count; ++i) {
+        auto& event = mEvents[(first + i) % mEvents.size()];
+        fmt::format_to(
+            out,
+            "{}\n{{\"name\":{},\"cat\":{},\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+            i == 0 ? "" : ",",
+            names[event.name],
+            categories[event.name],
+            event.tid,
+            toMicros(event.begin - mStartedAt),
+            toMicros(event.end - event.begin)
+        );
+    }
+    fmt::format_to(out, "\n]}}\n");
+    file.close(); // 缓冲不在此释放: 停止前已通过 isRecording 检查的线程可能仍在写入
+    if (!file) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(count);
+}
+
+uint32_t TraceRecorder::currentThreadId() {
+    static std::atomic<uint32_t> nextId{1};
+    thread_local uint32_t        id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+TraceRecorder& TraceRecorder::getInstance() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+
+void Export_TraceRecorder() {
+    // capacity <= 0 时使用默认容量，超过 MaxCapacity 时按 MaxCapacity 分配
+    exportAs("Trace_start", [](int capacity) -> bool {
+        return TraceRecorder::getInstance().start(
+            capacity > 0 ? static_cast<size_t>(capacity) : TraceRecorder::DefaultCapacity
+        );
+    });
+
+    exportAs("Trace_isRecording", []() -> bool { return TraceRecorder::getInstance().isRecording(); });
+
+    // 返回写出的事件数
+    exportFfi("Trace_stop", [](std::string const& path) -> FfiResult<int> {
+        auto& recorder = TraceRecorder::getInstance();
+        if (!recorder.isRecording()) {
+            return FfiError{"trace is not recording"};
+        }
+        auto count = recorder.stop(std::u8string{path.begin(), path.end()});
+        if (!count) {
+            return FfiError{fmt::format("failed to write trace file '{}'", path)};
+        }
+        return static_cast<int>(*count);
+    });
+}
+
+
+} // namespace ldapi
@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace ldapi {
+
+
+// 编译期开关: 定义 LDAPI_INSTRUMENTATION 时导出函数经 instrumentCall 包装 (调用统计 + 时间线) 且可以录制 trace
+// 未定义时导出函数直接注册，调用统计与 trace 录制均不可用
+#ifdef LDAPI_INSTRUMENTATION
+inline constexpr bool InstrumentationEnabled = true;
+#else
+inline constexpr bool InstrumentationEnabled = false;
+#endif
+
+
+/**
+ * Chrome trace 格式的时间线录制 (可在 Perfetto / chrome://tracing 中打开)
+ * 事件写入预分配的环形缓冲，写满后覆盖最旧的记录；未录制时 record 只有一次 relaxed load
+ * 名称在注册时 intern 为编号，录制路径不分配内存
+ */
+class TraceRecorder {
+public:
+    static constexpr uint32_t NoName          = static_cast<uint32_t>(-1);
+    static constexpr size_t   DefaultCapacity = 1 << 18;
+    static constexpr size_t   MaxCapacity     = 1 << 22; // 约 96 MiB
+
+    /// 注册名称 (冷路径)，category 为 Chrome trace 中的 cat 字段；同名同类别的名称共用一个编号
+    uint32_t intern(std::string name, char const* category);
+
+    /// 开始录制，清空之前的记录，容量限制在 [1, MaxCapacity]；正在录制或未启用 LDAPI_INSTRUMENTATION 时返回 false
+    bool start(size_t capacity = DefaultCapacity);
+
+    /// 停止录制并写出 JSON，返回写出的事件数；未在录制或文件无法写入时返回 nullopt
+    std::optional<size_t> stop(std::filesystem::path const& path);
+
+    [[nodiscard]] bool isRecording() const { return mRecording.load(std::memory_order_relaxed); }
+
+    void record(uint32_t name, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end) {
+        if (name == NoName || !isRecording()) {
+            return;
+        }
+        auto  index = mNext.fetch_add(1, std::memory_order_relaxed);
+        auto& event = mEvents[index % mEvents.size()];
+        event       = {name, currentThreadId(), begin, end};
+    }
+
+    static TraceRecorder& getInstance();
+
+private:
+    struct Name {
+        std::string name;
+        char const* category;
+    };
+    struct Event {
+        uint32_t                              name;
+        uint32_t                              tid;
+        std::chrono::steady_clock::time_point begin;
+        std::chrono::steady_clock::time_point end;
+    };
+
+    TraceRecorder() = default;
+
+    static uint32_t currentThreadId();
+
+    std::deque<Name>                          mNames;   // deque 扩容不移动已有元素
+    std::unordered_map<std::string, uint32_t> mNameIds; // key: "类别/名称"
+    std::mutex                                mNamesMutex;
+    std::vector<Event>                        mEvents;
+    std::atomic<uint64_t>                     mNext{0};
+    std::atomic<bool>                         mRecording{false};
+    std::chrono::steady_clock::time_point     mStartedAt;
+};
+
+
+} // namespace ldapi
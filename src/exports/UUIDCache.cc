@@ -0,0 +1,63 @@
+#include "exports/UUIDCache.h"
+
+#include "ExportDef.h"
+
+#include <vector>
+
+
+namespace ldapi {
+
+
+std::optional<mce::UUID> UUIDCache::parse(std::string const& str) {
+    if (auto iter = mParsed.find(str); iter != mParsed.end()) {
+        ++mParseHits;
+        return iter->second;
+    }
+    ++mParseMisses;
+    if (!mce::UUID::canParse(str)) {
+        return std::nullopt;
+    }
+    if (mParsed.size() >= MaxEntries) {
+        mParsed.clear();
+    }
+    return mParsed.emplace(str, mce::UUID{str}).first->second;
+}
+
+std::string UUIDCache::format(mce::UUID const& uuid) {
+    if (auto iter = mFormatted.find(uuid); iter != mFormatted.end()) {
+        ++mFormatHits;
+        return iter->second;
+    }
+    ++mFormatMisses;
+    if (mFormatted.size() >= MaxEntries) {
+        mFormatted.clear();
+    }
+    return mFormatted.emplace(uuid, uuid.asString()).first->second;
+}
+
+UUIDCache::Stats UUIDCache::getStats() const {
+    return {mParseHits, mParseMisses, mFormatHits, mFormatMisses, mParsed.size() + mFormatted.size()};
+}
+
+UUIDCache& UUIDCache::getInstance() {
+    static UUIDCache instance;
+    return instance;
+}
+
+
+void Export_UUIDCache() {
+    // [parseHits, parseMisses, formatHits, formatMisses, entries]
+    exportAs("UUIDCache_getStats", []() -> std::vector<int64_t> {
+        auto stats = UUIDCache::getInstance().getStats();
+        return {
+            static_cast<int64_t>(stats.parseHits),
+            static_cast<int64_t>(stats.parseMisses),
+            static_cast<int64_t>(stats.formatHits),
+            static_cast<int64_t>(stats.formatMisses),
+            static_cast<int64_t>(stats.entries)
+        };
+    });
+}
+
+
+} // namespace ldapi
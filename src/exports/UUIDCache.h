@@ -0,0 +1,56 @@
+#pragma once
+#include "mc/platform/UUID.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+
+namespace ldapi {
+
+
+/**
+ * 玩家 UUID 字符串 <-> mce::UUID 的双向缓存
+ * 导出接口反复解析 / 格式化同一批在线玩家的 UUID，缓存后两者都只需一次哈希查找
+ */
+class UUIDCache {
+public:
+    static constexpr size_t MaxEntries = 8192; // 单向上限，超出后整体清空
+
+    struct Stats {
+        uint64_t parseHits;
+        uint64_t parseMisses;
+        uint64_t formatHits;
+        uint64_t formatMisses;
+        size_t   entries;
+    };
+
+    /// 解析 UUID 字符串，无效时返回 nullopt (无效字符串不会进入缓存)
+    std::optional<mce::UUID> parse(std::string const& str);
+
+    /// 格式化 UUID；返回副本，缓存清空不影响已取得的结果 (同一表达式中多次调用也安全)
+    std::string format(mce::UUID const& uuid);
+
+    [[nodiscard]] Stats getStats() const;
+
+    static UUIDCache& getInstance();
+
+private:
+    UUIDCache() = default;
+
+    uint64_t                                   mParseHits{0};
+    uint64_t                                   mParseMisses{0};
+    uint64_t                                   mFormatHits{0};
+    uint64_t                                   mFormatMisses{0};
+    std::unordered_map<std::string, mce::UUID> mParsed;
+    std::unordered_map<mce::UUID, std::string> mFormatted;
+};
+
+
+inline std::optional<mce::UUID> parseUUID(std::string const& str) { return UUIDCache::getInstance().parse(str); }
+
+inline std::string formatUUID(mce::UUID const& uuid) { return UUIDCache::getInstance().format(uuid); }
+
+
+} // namespace ldapi
@@ -11,6 +11,12 @@ extern void Export_Class_LandAABB();
 extern void Export_Class_Land();
 extern void Export_LDEvents();
 extern void export_LeasingService();
+extern void Export_LandGeometry();
+extern void Export_Ffi();
+extern void Export_UUIDCache();
+extern void Export_CallMetrics();
+extern void Export_TraceRecorder();
+extern void Register_Command();
 
 } // namespace ldapi
 
@@ -31,6 +37,12 @@ bool MyMod::enable() {
     ldapi::Export_Class_Land();
     ldapi::Export_LDEvents();
     ldapi::export_LeasingService();
+    ldapi::Export_LandGeometry();
+    ldapi::Export_Ffi();
+    ldapi::Export_UUIDCache();
+    ldapi::Export_CallMetrics();
+    ldapi::Export_TraceRecorder();
+    ldapi::Register_Command();
 
     return true;
 }
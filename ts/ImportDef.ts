@@ -2,6 +2,7 @@ const ExportNamespace = "PLand_LDAPI"; // ExportDef.h
 export const ImportNamespace = ExportNamespace;
 
 export type LandID = number; // int64_t as number
+export type LandRef = number; // LandID 或 Land_getHandle 返回的句柄 (负数)
 export type UUID = string; // mce::UUID as string
 
 export const INVALID_LAND_ID: LandID = -1;
@@ -74,6 +75,64 @@ export function asExpected<T>(protocol: FfiProtocol): Expected<T> {
     return new Expected<T>(payload);
 }
 
+/**
+ * 原生协议: [status, errorIndex, value?]
+ * 成功路径不经过 JSON，失败时通过 errorIndex 取回错误信息
+ */
+export type FfiNativeProtocol = [status: FfiStatus, errorIndex: number, value?: any];
+
+export enum FfiStatus {
+    Ok = 0,
+    Error = 1,
+}
+
+export enum FfiMode {
+    Json = 0,
+    Native = 1,
+}
+
+let ffiMode = FfiMode.Json;
+
+/**
+ * 设置 FFI 调用使用的协议
+ * @note 默认 Json 以兼容旧版本，Native 模式需要配套版本的 PLand-LegacyRemoteCallApi
+ */
+export function setFfiMode(mode: FfiMode): void {
+    ffiMode = mode;
+}
+
+export function getFfiMode(): FfiMode {
+    return ffiMode;
+}
+
+const Ffi_getError = importSymbol("Ffi_getError") as (index: number) => string;
+
+export function fromNative<T>(protocol: FfiNativeProtocol): Expected<T> {
+    if (protocol[0] !== FfiStatus.Ok) {
+        return new Expected<T>({ok: false, error: Ffi_getError(protocol[1])});
+    }
+    if (protocol.length > 2) {
+        return new Expected<T>({ok: true, value: protocol[2]} as FfiSuccess<T>);
+    }
+    return new Expected<T>({ok: true} as FfiSuccess<T>);
+}
+
+/**
+ * 按当前协议模式调用 FFI 函数
+ * @param json JSON 协议导出 (sym)
+ * @param native 原生协议导出 (sym_Native)
+ */
+export function invokeFfi<T>(
+    json: (...args: any[]) => FfiProtocol,
+    native: (...args: any[]) => FfiNativeProtocol,
+    ...args: any[]
+): Expected<T> {
+    if (ffiMode === FfiMode.Native) {
+        return fromNative<T>(native(...args));
+    }
+    return asExpected<T>(json(...args));
+}
+
 export class Expected<T> {
     private payload: FfiPayload<T>;
 
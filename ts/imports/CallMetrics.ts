@@ -0,0 +1,48 @@
+import {importSymbol} from "../ImportDef.js";
+
+export interface CallMetricsEntry {
+    symbol: string;
+    calls: number;
+    totalNs: number;
+    maxNs: number;
+    payloadBytes: number; // string / 数组返回值的累计字节数
+}
+
+/**
+ * 导出函数调用统计 (默认关闭)
+ * 也可在控制台使用 `ldapi calls [on|off|reset]`
+ * @note 仅在以 LDAPI_INSTRUMENTATION 编译 (debug 模式或 xmake f --ldapi_instrumentation=y) 时可用，否则 setEnabled 无效
+ */
+export class CallMetrics {
+    constructor() {
+        throw new Error("Cannot create an instance of CallMetrics");
+    }
+
+    static SYMBOLS = {
+        CallMetrics_setEnabled: importSymbol("CallMetrics_setEnabled") as (enabled: boolean) => void,
+        CallMetrics_isEnabled: importSymbol("CallMetrics_isEnabled") as () => boolean,
+        CallMetrics_getTop: importSymbol("CallMetrics_getTop") as (n: number) => string,
+        CallMetrics_reset: importSymbol("CallMetrics_reset") as () => void,
+    }
+
+    static setEnabled(enabled: boolean): void {
+        CallMetrics.SYMBOLS.CallMetrics_setEnabled(enabled);
+    }
+
+    static isEnabled(): boolean {
+        return CallMetrics.SYMBOLS.CallMetrics_isEnabled();
+    }
+
+    /**
+     * 按累计耗时降序获取前 n 个导出函数的统计
+     */
+    static getTop(n: number = 20): CallMetricsEntry[] {
+        return JSON.parse(CallMetrics.SYMBOLS.CallMetrics_getTop(n));
+    }
+
+    static reset(): void {
+        CallMetrics.SYMBOLS.CallMetrics_reset();
+    }
+}
+
+Object.freeze(CallMetrics.SYMBOLS);
@@ -1,5 +1,5 @@
 import {ImportNamespace, LandID, UUID} from "../ImportDef.js";
-import {LeaseState} from "./Land.js";
+import {LandType, LeaseState} from "./Land.js";
 
 
 /**
@@ -67,6 +67,86 @@ type EventParams = {
 
 export type EventType = keyof EventParams;
 
+/**
+ * 监听器句柄，可用于 LDEvent.remove
+ */
+export type ListenerHandle = number;
+
+/**
+ * 原生侧事件过滤器，条件之间为 "与" 关系
+ * @note 仅对携带领地信息的事件有效
+ */
+export interface EventFilter {
+    lands?: LandID[];
+    dimid?: number;
+    owner?: UUID;
+    landType?: LandType;
+}
+
+/**
+ * 延迟投递: 事件参数复制到有界队列，每 tick 在时间预算内投递，不阻塞 PLand 的调用路径
+ * @note 仅不可拦截的事件 (After 类事件等) 可以使用；回调返回值被忽略
+ * @note Player 参数在投递时重新查找，玩家已离线则放弃该事件
+ */
+export interface DeferredOptions {
+    /**
+     * 队列已满时的策略 (默认 dropOldest)
+     * - dropOldest: 丢弃最旧的事件
+     * - block: 同步投递最旧的事件以腾出空间
+     * - coalesce: 与队列中同一领地、参数相同的事件合并，没有可合并的事件时丢弃最旧的事件
+     */
+    policy?: "dropOldest" | "block" | "coalesce";
+    capacity?: number; // 默认 1024
+}
+
+export interface ListenOptions {
+    filter?: EventFilter;
+    deferred?: DeferredOptions;
+}
+
+export interface QueueStats {
+    depth: number;
+    maxDepth: number;
+    capacity: number;
+    enqueued: number;
+    delivered: number;
+    dropped: number;
+    coalesced: number;
+    blocked: number;
+}
+
+export interface ListenerStats {
+    delivered: number; // 调用回调的次数 (批量模式为记录条数)
+    skipped: number;   // 被过滤器拒绝的次数
+}
+
+/**
+ * 派发统计，耗时单位为纳秒 (对数分桶，百分位为近似值)
+ */
+export interface DispatchStats {
+    invocations: number;
+    cancels: number;
+    exceptions: number;
+    p50Ns: number;
+    p99Ns: number;
+    maxNs: number;
+}
+
+export interface EventStats {
+    events: Record<string, DispatchStats>;
+    listeners: (DispatchStats & ListenerStats & {handle: ListenerHandle, event: string, id: string})[];
+}
+
+export enum PresenceKind {
+    Enter = 0,
+    Leave = 1,
+}
+
+/**
+ * 批量投递的进入 / 离开领地记录 (uuids[i], landIds[i], kinds[i] 为同一条记录)
+ */
+export type PresenceBatchCallback = (uuids: UUID[], landIds: LandID[], kinds: PresenceKind[]) => boolean;
+
 export class LDEvent {
     static IMPORTS = {
         ScriptEventManager_genListenerID: ll.imports(
@@ -77,6 +157,34 @@ export class LDEvent {
             ImportNamespace,
             "Event_RegisterListener",
         ),
+        Event_RegisterListenerEx: ll.imports(
+            ImportNamespace,
+            "Event_RegisterListenerEx",
+        ) as (event: string, id: string, options: string) => ListenerHandle,
+        Event_RemoveListener: ll.imports(
+            ImportNamespace,
+            "Event_RemoveListener",
+        ) as (handle: ListenerHandle) => boolean,
+        Event_getListenerStats: ll.imports(
+            ImportNamespace,
+            "Event_getListenerStats",
+        ) as (handle: ListenerHandle) => number[],
+        Event_getQueueStats: ll.imports(
+            ImportNamespace,
+            "Event_getQueueStats",
+        ) as (handle: ListenerHandle) => number[],
+        Event_setDeferredBudget: ll.imports(
+            ImportNamespace,
+            "Event_setDeferredBudget",
+        ) as (microseconds: number) => void,
+        Event_getStats: ll.imports(
+            ImportNamespace,
+            "Event_getStats",
+        ) as () => string,
+        Event_resetStats: ll.imports(
+            ImportNamespace,
+            "Event_resetStats",
+        ) as () => void,
     };
 
     constructor() {
@@ -87,6 +195,7 @@ export class LDEvent {
      * 监听事件
      * @warnging **无论事件是否可以拦截，都必须返回一个布尔值, 否则RemoteCall会抛出 `bad_variant_access`**
      * @note **`true`: 放行 / `false` 拦截(由事件决定)**
+     * @note 等同于不带选项的 on，监听器随当前脚本卸载而失效
      * @param event 事件类型
      * @param callback 回调函数
      * @returns 是否成功注册
@@ -95,13 +204,109 @@ export class LDEvent {
         event: T,
         callback: (...args: EventParams[T]) => boolean,
     ): boolean {
+        LDEvent.on(event, callback);
+        return true;
+    }
+
+    /**
+     * 监听事件并返回句柄
+     * @note 回调在注册时解析一次，派发时不再检查；当前脚本卸载或禁用后，监听器在下一 tick 由原生侧移除
+     * @param event 事件类型
+     * @param callback 回调函数 (返回值含义同 listen)
+     * @param options.filter 原生侧过滤器，不匹配的事件不会调用回调
+     * @param options.deferred 延迟投递选项
+     * @returns 监听器句柄
+     */
+    static on<T extends EventType>(
+        event: T,
+        callback: (...args: EventParams[T]) => boolean,
+        options: ListenOptions = {},
+    ): ListenerHandle {
         const id = LDEvent.IMPORTS.ScriptEventManager_genListenerID();
         ll.exports(callback, event, id);
-        const ok = LDEvent.IMPORTS.Event_RegisterListener(event, id);
-        if (!ok) {
+        const nativeOptions = {owner: ll.getCurrentPluginInfo().name, ...options};
+        const handle = LDEvent.IMPORTS.Event_RegisterListenerEx(event, id, JSON.stringify(nativeOptions));
+        if (handle === -1) {
             throw new Error("Failed to register listener for event " + event);
         }
-        return ok;
+        return handle;
+    }
+
+    /**
+     * 批量监听玩家进入 / 离开领地
+     * @note 事件在原生侧排队，每 tick (或每隔 intervalMs) 合并为一次回调；窗口内抵消的进入 + 离开不会投递
+     * @note 记录中为玩家 UUID 而不是 Player，投递时玩家可能已经离线
+     * @param callback 回调函数 (必须返回布尔值，返回值被忽略)
+     * @param intervalMs 投递间隔，0 表示每 tick
+     * @param filter 原生侧过滤器
+     * @returns 监听器句柄
+     */
+    static onPresenceBatch(
+        callback: PresenceBatchCallback,
+        intervalMs: number = 0,
+        filter?: EventFilter,
+    ): ListenerHandle {
+        const event: EventType = "PlayerEnterLandEvent";
+        const id = LDEvent.IMPORTS.ScriptEventManager_genListenerID();
+        ll.exports(callback, event, id);
+        const options = {owner: ll.getCurrentPluginInfo().name, batch: {intervalMs}, filter};
+        const handle = LDEvent.IMPORTS.Event_RegisterListenerEx(event, id, JSON.stringify(options));
+        if (handle === -1) {
+            throw new Error("Failed to register presence batch listener");
+        }
+        return handle;
+    }
+
+    /**
+     * 移除监听器
+     * @returns 句柄是否有效
+     */
+    static remove(handle: ListenerHandle): boolean {
+        return LDEvent.IMPORTS.Event_RemoveListener(handle);
+    }
+
+    /**
+     * 获取监听器的投递统计
+     * @returns 句柄无效时为 null
+     */
+    static getListenerStats(handle: ListenerHandle): ListenerStats | null {
+        const stats = LDEvent.IMPORTS.Event_getListenerStats(handle);
+        if (stats.length === 0) {
+            return null;
+        }
+        return {delivered: stats[0], skipped: stats[1]};
+    }
+
+    /**
+     * 获取延迟投递队列统计
+     * @param handle 监听器句柄，省略时返回所有延迟队列之和 (含已移除的监听器)
+     * @returns 句柄无效或不是延迟投递时为 null
+     */
+    static getQueueStats(handle: ListenerHandle = -1): QueueStats | null {
+        const stats = LDEvent.IMPORTS.Event_getQueueStats(handle);
+        if (stats.length === 0) {
+            return null;
+        }
+        const [depth, maxDepth, capacity, enqueued, delivered, dropped, coalesced, blocked] = stats;
+        return {depth, maxDepth, capacity, enqueued, delivered, dropped, coalesced, blocked};
+    }
+
+    /**
+     * 设置每 tick 投递延迟事件的时间预算 (默认 2000 微秒)
+     */
+    static setDeferredBudget(microseconds: number): void {
+        LDEvent.IMPORTS.Event_setDeferredBudget(microseconds);
+    }
+
+    /**
+     * 获取按事件类型和监听器统计的派发次数、拦截 / 异常次数及耗时分布
+     */
+    static getStats(): EventStats {
+        return JSON.parse(LDEvent.IMPORTS.Event_getStats());
+    }
+
+    static resetStats(): void {
+        LDEvent.IMPORTS.Event_resetStats();
     }
 }
 
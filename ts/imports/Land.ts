@@ -2,11 +2,18 @@ import {
     importSymbol, INVALID_LAND_ID,
     isIntPos,
     LandID,
+    LandRef,
     LandPermType,
     UUID,
-    InternalLandAABB
+    InternalLandAABB,
+    asExpected,
+    Expected,
+    FfiPayload,
+    FfiProtocol,
+    FfiNativeProtocol,
+    invokeFfi
 } from "../ImportDef.js";
-import {LandAABB} from "./LandAABB.js";
+import {BorderSegment, LandAABB} from "./LandAABB.js";
 
 
 export interface EnvironmentPerms {
@@ -93,6 +100,28 @@ export interface LandPermTable {
     role: RolePerms;
 }
 
+export type PermRole = keyof RoleEntry;
+
+export type PermFieldName = keyof EnvironmentPerms | keyof RolePerms;
+
+export enum PermCheckResult {
+    Invalid = -1, // UUID 或权限字段无效
+    Deny = 0,
+    Allow = 1,
+    NoLand = 2,   // 坐标处没有领地
+}
+
+export interface PermCheck {
+    pos: IntPos;
+    uuid: UUID;
+    field: PermFieldName;
+}
+
+/** 单个权限标志的修改，环境权限不需要 role */
+export type PermEdit =
+    | { field: keyof EnvironmentPerms; role?: undefined; value: boolean }
+    | { field: keyof RolePerms; role: PermRole; value: boolean };
+
 export enum LandType {
     Ordinary = 0, // 普通领地(无父、无子)
     Parent = 1, // 父领地(无父、有子)
@@ -120,6 +149,86 @@ export enum LeaseState {
     Expired = 3, // 已到期(已回收)
 }
 
+/**
+ * 领地快照字段 (位掩码)
+ * @see Land.getSnapshots
+ */
+export enum LandSnapshotField {
+    Name = 1 << 0,
+    Owner = 1 << 1,
+    DimensionId = 1 << 2,
+    AABB = 1 << 3,
+    TeleportPos = 1 << 4,
+    Members = 1 << 5,
+    Type = 1 << 6,
+    HoldType = 1 << 7,
+    LeaseState = 1 << 8,
+    LeaseStartAt = 1 << 9,
+    LeaseEndAt = 1 << 10,
+    OriginalBuyPrice = 1 << 11,
+    Is3D = 1 << 12,
+    ParentLandID = 1 << 13,
+    SubLandIDs = 1 << 14,
+    NestedLevel = 1 << 15,
+    PermTable = 1 << 16,
+
+    All = (1 << 17) - 1,
+}
+
+/**
+ * 领地快照，仅包含请求的字段
+ */
+export interface LandSnapshot {
+    id: LandID;
+    name?: string;
+    owner?: UUID;
+    dimid?: number;
+    aabb?: LandAABB;
+    teleportPos?: IntPos;
+    members?: UUID[];
+    type?: LandType;
+    holdType?: LandHoldType;
+    leaseState?: LeaseState;
+    leaseStartAt?: Date;
+    leaseEndAt?: Date;
+    originalBuyPrice?: number;
+    is3D?: boolean;
+    parentLandID?: LandID;
+    subLandIDs?: LandID[];
+    nestedLevel?: number;
+    permTable?: LandPermTable;
+}
+
+type RawLandSnapshot = Omit<LandSnapshot, "aabb" | "teleportPos" | "leaseStartAt" | "leaseEndAt"> & {
+    aabb?: [number, number, number, number, number, number];
+    teleportPos?: [number, number, number];
+    leaseStartAt?: string;
+    leaseEndAt?: string;
+};
+
+/**
+ * 批量修改操作
+ * @see Land.applyBatch
+ */
+export type LandBatchOp =
+    | { op: "setOwner"; id: LandID; value: UUID }
+    | { op: "setName"; id: LandID; value: string }
+    | { op: "setPermTable"; id: LandID; value: LandPermTable }
+    | { op: "addMember"; id: LandID; value: UUID }
+    | { op: "removeMember"; id: LandID; value: UUID }
+    | { op: "setOriginalBuyPrice"; id: LandID; value: number };
+
+export interface LandHandleStats {
+    slots: number;
+    live: number;
+}
+
+export interface PermCacheStats {
+    hits: number;
+    misses: number;
+    entries: number;
+}
+
 export class Land {
     static SYMBOLS = {
         Land_getAABB: importSymbol("Land_getAABB") as (
@@ -150,6 +259,8 @@ export class Land {
             table: string
         ) => void,
 
+        Land_getPermCacheStats: importSymbol("Land_getPermCacheStats") as () => number[],
+
         Land_getOwner: importSymbol("Land_getOwner") as (id: LandID) => UUID,
 
         Land_setOwner: importSymbol("Land_setOwner") as (
@@ -273,21 +384,178 @@ export class Land {
         Land_getLeaseState: importSymbol("Land_getLeaseState") as (id: LandID) => LeaseState,
         Land_getLeaseStartAt: importSymbol("Land_getLeaseStartAt") as (id: LandID) => string,
         Land_getLeaseEndAt: importSymbol("Land_getLeaseEndAt") as (id: LandID) => string,
+
+        Land_getHandle: importSymbol("Land_getHandle") as (id: LandRef) => LandRef,
+        Land_getHandleStats: importSymbol("Land_getHandleStats") as () => number[],
+
+        Land_getSnapshots: importSymbol("Land_getSnapshots") as (
+            ids: LandID[],
+            fieldMask: number
+        ) => string,
+
+        Land_applyBatch: importSymbol("Land_applyBatch") as (
+            operations: string
+        ) => FfiProtocol,
+
+        Land_getBorderSegments: importSymbol("Land_getBorderSegments") as (
+            id: LandID,
+            step: number
+        ) => BorderSegment[],
+
+        Land_getPerm: importSymbol("Land_getPerm") as (
+            id: LandID,
+            field: string,
+            role: string
+        ) => number,
+
+        Land_checkPerm: importSymbol("Land_checkPerm") as (
+            pos: IntPos,
+            uuid: UUID,
+            field: string
+        ) => PermCheckResult,
+
+        Land_checkPerms: importSymbol("Land_checkPerms") as (
+            positions: IntPos[],
+            uuids: UUID[],
+            fields: string[]
+        ) => PermCheckResult[],
+
+        Land_setPerms: importSymbol("Land_setPerms") as (
+            id: LandID,
+            fields: string[],
+            roles: string[],
+            values: number[]
+        ) => FfiProtocol,
+
+        Land_setPerms_Native: importSymbol("Land_setPerms_Native") as (
+            id: LandID,
+            fields: string[],
+            roles: string[],
+            values: number[]
+        ) => FfiNativeProtocol,
     };
 
     readonly mLandId: LandID = -1;
 
+    private static sUseHandles = false;
+    private mHandle: LandRef | undefined = undefined;
+
     constructor(id: LandID) {
         this.mLandId = id;
     }
 
+    /**
+     * 句柄模式: 开启后每个 Land 对象在首次调用时向原生侧申请句柄，之后的调用直接定位领地，不再查询注册表
+     * 领地删除后句柄失效，行为与使用已删除的领地 ID 相同
+     */
+    static useHandles(enabled: boolean): void {
+        Land.sUseHandles = enabled;
+    }
+
+    /**
+     * 获取领地句柄槽位的统计
+     */
+    static getHandleStats(): LandHandleStats {
+        const [slots, live] = Land.SYMBOLS.Land_getHandleStats();
+        return {slots, live};
+    }
+
+    /** 调用原生接口时使用的领地引用 */
+    private get ref(): LandRef {
+        if (!Land.sUseHandles) {
+            return this.mLandId;
+        }
+        if (this.mHandle === undefined) {
+            const handle = Land.SYMBOLS.Land_getHandle(this.mLandId);
+            this.mHandle = handle === INVALID_LAND_ID ? this.mLandId : handle;
+        }
+        return this.mHandle;
+    }
+
+    /**
+     * 检查玩家在某坐标处是否拥有权限
+     * 领地查询、身份判定与权限读取都在一次原生调用内完成
+     * @param field 权限字段名，角色权限会按玩家身份 (成员 / 访客) 选择对应标志
+     */
+    static checkPerm(pos: IntPos, uuid: UUID, field: PermFieldName): PermCheckResult {
+        return Land.SYMBOLS.Land_checkPerm(pos, uuid, field);
+    }
+
+    /**
+     * 批量检查权限，结果与 checks 一一对应
+     */
+    static checkPerms(checks: PermCheck[]): PermCheckResult[] {
+        return Land.SYMBOLS.Land_checkPerms(
+            checks.map(c => c.pos),
+            checks.map(c => c.uuid),
+            checks.map(c => c.field),
+        );
+    }
+
+    /**
+     * 获取权限表序列化缓存的命中统计
+     */
+    static getPermCacheStats(): PermCacheStats {
+        const [hits, misses, entries] = Land.SYMBOLS.Land_getPermCacheStats();
+        return {hits, misses, entries};
+    }
+
+    /**
+     * 批量获取领地快照
+     * @param lands 领地列表
+     * @param fields 需要的字段 (LandSnapshotField 位掩码)
+     * @returns 与 lands 一一对应的快照，领地不存在时为 null
+     * @note 一次跨引擎调用即可取回所有领地的所有字段，适用于列表、排行榜等批量渲染场景
+     */
+    static getSnapshots(
+        lands: (Land | LandID)[],
+        fields: number = LandSnapshotField.All
+    ): (LandSnapshot | null)[] {
+        const ids = lands.map((land) => (typeof land === "number" ? land : land.mLandId));
+        const raw = JSON.parse(Land.SYMBOLS.Land_getSnapshots(ids, fields)) as (RawLandSnapshot | null)[];
+        return raw.map((item) => {
+            if (item === null) {
+                return null;
+            }
+            const {aabb, teleportPos, leaseStartAt, leaseEndAt, ...rest} = item;
+            const snapshot: LandSnapshot = rest;
+            if (aabb !== undefined) {
+                snapshot.aabb = new LandAABB(
+                    new IntPos(aabb[0], aabb[1], aabb[2], item.dimid!),
+                    new IntPos(aabb[3], aabb[4], aabb[5], item.dimid!)
+                );
+            }
+            if (teleportPos !== undefined) {
+                snapshot.teleportPos = new IntPos(teleportPos[0], teleportPos[1], teleportPos[2], item.dimid!);
+            }
+            if (leaseStartAt !== undefined) {
+                snapshot.leaseStartAt = new Date(Number(leaseStartAt) * 1000);
+            }
+            if (leaseEndAt !== undefined) {
+                snapshot.leaseEndAt = new Date(Number(leaseEndAt) * 1000);
+            }
+            return snapshot;
+        });
+    }
+
+    /**
+     * 批量修改领地
+     * @param ops 操作列表
+     * @returns 与 ops 一一对应的执行结果
+     * @note 所有操作会先统一校验 (领地是否存在、UUID 是否合法、按顺序重复添加或移除不存在的成员等)，任意一项校验失败则不会应用任何操作
+     */
+    static applyBatch(ops: LandBatchOp[]): Expected<FfiPayload<void>[]> {
+        const protocol = Land.SYMBOLS.Land_applyBatch(JSON.stringify(ops));
+        return asExpected<FfiPayload<void>[]>(protocol);
+    }
+
     /**
      * @brief 判断当前领地是否为系统所有
      * @return true/false
      * @version v0.19.x
      */
     isSystemOwned() {
-        return Land.SYMBOLS.Land_isSystemOwned(this.mLandId);
+        return Land.SYMBOLS.Land_isSystemOwned(this.ref);
     }
 
     /**
@@ -296,7 +564,7 @@ export class Land {
      * @version v0.19.x
      */
     isBought(): boolean {
-        return Land.SYMBOLS.Land_isBought(this.mLandId);
+        return Land.SYMBOLS.Land_isBought(this.ref);
     };
 
     /**
@@ -305,7 +573,7 @@ export class Land {
      * @version v0.19.x
      */
     isLeased(): boolean {
-        return Land.SYMBOLS.Land_isLeased(this.mLandId);
+        return Land.SYMBOLS.Land_isLeased(this.ref);
     };
 
     /**
@@ -314,7 +582,7 @@ export class Land {
      * @version v0.19.x
      */
     isLeaseActive(): boolean {
-        return Land.SYMBOLS.Land_isLeaseActive(this.mLandId);
+        return Land.SYMBOLS.Land_isLeaseActive(this.ref);
     };
 
     /**
@@ -323,7 +591,7 @@ export class Land {
      * @version v0.19.x
      */
     isLeaseFrozen(): boolean {
-        return Land.SYMBOLS.Land_isLeaseFrozen(this.mLandId);
+        return Land.SYMBOLS.Land_isLeaseFrozen(this.ref);
     };
 
     /**
@@ -332,7 +600,7 @@ export class Land {
      * @version v0.19.x
      */
     isLeaseExpired(): boolean {
-        return Land.SYMBOLS.Land_isLeaseExpired(this.mLandId);
+        return Land.SYMBOLS.Land_isLeaseExpired(this.ref);
     };
 
     /**
@@ -340,7 +608,7 @@ export class Land {
      * @version v0.19.x
      */
     getHoldType() {
-        return Land.SYMBOLS.Land_getHoldType(this.mLandId);
+        return Land.SYMBOLS.Land_getHoldType(this.ref);
     }
 
     /**
@@ -348,7 +616,7 @@ export class Land {
      * @version v0.19.x
      */
     getLeaseState() {
-        return Land.SYMBOLS.Land_getLeaseState(this.mLandId);
+        return Land.SYMBOLS.Land_getLeaseState(this.ref);
     }
 
     /**
@@ -356,7 +624,7 @@ export class Land {
      * @version v0.19.x
      */
     getLeaseStartAt(): Date | null {
-        const timestampStr = Land.SYMBOLS.Land_getLeaseStartAt(this.mLandId);
+        const timestampStr = Land.SYMBOLS.Land_getLeaseStartAt(this.ref);
         if (timestampStr.length == 0) {
             return null; // 领地不存在
         }
@@ -368,7 +636,7 @@ export class Land {
      * @version v0.19.x
      */
     getLeaseEndAt(): Date | null {
-        const timestampStr = Land.SYMBOLS.Land_getLeaseEndAt(this.mLandId);
+        const timestampStr = Land.SYMBOLS.Land_getLeaseEndAt(this.ref);
         if (timestampStr.length == 0) {
             return null; // 领地不存在
         }
@@ -381,31 +649,40 @@ export class Land {
      * @returns
      */
     getAABB(): LandAABB | null {
-        const result = Land.SYMBOLS.Land_getAABB(this.mLandId);
+        const result = Land.SYMBOLS.Land_getAABB(this.ref);
         if (result.length > 0) {
             return new LandAABB(result[0], result[1]);
         }
         return null;
     }
 
+    /**
+     * 获取领地边框线段
+     * @param step 抽样步长
+     * @note 结果按领地缓存，领地范围变化后自动失效，适合高频绘制粒子边框
+     */
+    getBorderSegments(step = 1): BorderSegment[] {
+        return Land.SYMBOLS.Land_getBorderSegments(this.ref, step);
+    }
+
     getTeleportPos(): IntPos {
-        return Land.SYMBOLS.Land_getTeleportPos(this.mLandId);
+        return Land.SYMBOLS.Land_getTeleportPos(this.ref);
     }
 
     setTeleportPos(pos: IntPos): void {
-        Land.SYMBOLS.Land_setTeleportPos(this.mLandId, pos);
+        Land.SYMBOLS.Land_setTeleportPos(this.ref, pos);
     }
 
     getId(): LandID {
-        return Land.SYMBOLS.Land_getId(this.mLandId);
+        return Land.SYMBOLS.Land_getId(this.ref);
     }
 
     getDimensionId(): number {
-        return Land.SYMBOLS.Land_getDimensionId(this.mLandId);
+        return Land.SYMBOLS.Land_getDimensionId(this.ref);
     }
 
     getPermTable(): LandPermTable | null {
-        const result = Land.SYMBOLS.Land_getPermTable(this.mLandId);
+        const result = Land.SYMBOLS.Land_getPermTable(this.ref);
         if (result === "") {
             return null;
         }
@@ -413,11 +690,38 @@ export class Land {
     }
 
     setPermTable(table: LandPermTable): void {
-        Land.SYMBOLS.Land_setPermTable(this.mLandId, JSON.stringify(table));
+        Land.SYMBOLS.Land_setPermTable(this.ref, JSON.stringify(table));
+    }
+
+    /**
+     * 读取单个权限标志 (不经过整张权限表的 JSON 序列化)
+     * @param field 权限字段名
+     * @param role 角色权限需指定 "member" / "actor"，环境权限留空
+     * @returns 领地不存在或字段无效时为 null
+     */
+    getPerm(field: keyof EnvironmentPerms): boolean | null;
+    getPerm(field: keyof RolePerms, role: PermRole): boolean | null;
+    getPerm(field: string, role: string = ""): boolean | null {
+        const result = Land.SYMBOLS.Land_getPerm(this.ref, field, role);
+        return result === -1 ? null : result === 1;
+    }
+
+    /**
+     * 批量修改权限标志，任一字段无效时不做任何修改
+     */
+    setPerms(edits: PermEdit[]): Expected<void> {
+        return invokeFfi<void>(
+            Land.SYMBOLS.Land_setPerms,
+            Land.SYMBOLS.Land_setPerms_Native,
+            this.ref,
+            edits.map(e => e.field),
+            edits.map(e => e.role ?? ""),
+            edits.map(e => (e.value ? 1 : 0)),
+        );
     }
 
     getOwner(): UUID {
-        return Land.SYMBOLS.Land_getOwner(this.mLandId);
+        return Land.SYMBOLS.Land_getOwner(this.ref);
     }
 
     /**
@@ -426,14 +730,14 @@ export class Land {
      * @note 如果UUID无效，此 API 返回 false
      */
     setOwner(owner: UUID): boolean {
-        return Land.SYMBOLS.Land_setOwner(this.mLandId, owner);
+        return Land.SYMBOLS.Land_setOwner(this.ref, owner);
     }
 
     /**
      * @deprecated Use getOwner() instead, this returns raw storage string (may be XUID or UUID).
      */
     getRawOwner(): string | null {
-        const id = Land.SYMBOLS.Land_getRawOwner(this.mLandId);
+        const id = Land.SYMBOLS.Land_getRawOwner(this.ref);
         if (id === "") {
             return null;
         }
@@ -441,7 +745,7 @@ export class Land {
     }
 
     getMembers(): UUID[] {
-        return Land.SYMBOLS.Land_getMembers(this.mLandId);
+        return Land.SYMBOLS.Land_getMembers(this.ref);
     }
 
     /**
@@ -451,62 +755,62 @@ export class Land {
      * @note 此函数拒绝添加 Owner 为 Member
      */
     addLandMember(uuid: UUID): boolean {
-        return Land.SYMBOLS.Land_addLandMember(this.mLandId, uuid);
+        return Land.SYMBOLS.Land_addLandMember(this.ref, uuid);
     }
 
     removeLandMember(uuid: UUID): boolean {
-        return Land.SYMBOLS.Land_removeLandMember(this.mLandId, uuid);
+        return Land.SYMBOLS.Land_removeLandMember(this.ref, uuid);
     }
 
     getName(): string {
-        return Land.SYMBOLS.Land_getName(this.mLandId);
+        return Land.SYMBOLS.Land_getName(this.ref);
     }
 
     setName(name: string): void {
-        Land.SYMBOLS.Land_setName(this.mLandId, name);
+        Land.SYMBOLS.Land_setName(this.ref, name);
     }
 
     getOriginalBuyPrice(): number {
-        return Land.SYMBOLS.Land_getOriginalBuyPrice(this.mLandId);
+        return Land.SYMBOLS.Land_getOriginalBuyPrice(this.ref);
     }
 
     setOriginalBuyPrice(price: number): void {
-        Land.SYMBOLS.Land_setOriginalBuyPrice(this.mLandId, price);
+        Land.SYMBOLS.Land_setOriginalBuyPrice(this.ref, price);
     }
 
     is3D(): boolean {
-        return Land.SYMBOLS.Land_is3D(this.mLandId);
+        return Land.SYMBOLS.Land_is3D(this.ref);
     }
 
     isOwner(uuid: UUID): boolean {
-        return Land.SYMBOLS.Land_isOwner(this.mLandId, uuid);
+        return Land.SYMBOLS.Land_isOwner(this.ref, uuid);
     }
 
     isMember(uuid: UUID): boolean {
-        return Land.SYMBOLS.Land_isMember(this.mLandId, uuid);
+        return Land.SYMBOLS.Land_isMember(this.ref, uuid);
     }
 
     /**
      * @deprecated
      */
     isConvertedLand(): boolean {
-        return Land.SYMBOLS.Land_isConvertedLand(this.mLandId);
+        return Land.SYMBOLS.Land_isConvertedLand(this.ref);
     }
 
     /**
      * @deprecated
      */
     isOwnerDataIsXUID(): boolean {
-        return Land.SYMBOLS.Land_isOwnerDataIsXUID(this.mLandId);
+        return Land.SYMBOLS.Land_isOwnerDataIsXUID(this.ref);
     }
 
     isCollision(pos: IntPos, radius: number): boolean;
     isCollision(pos1: IntPos, pos2: IntPos): boolean;
     isCollision(pos1: IntPos, pos2: any): boolean {
         if (typeof pos2 === "number") {
-            return Land.SYMBOLS.Land_isCollision(this.mLandId, pos1, pos2);
+            return Land.SYMBOLS.Land_isCollision(this.ref, pos1, pos2);
         } else if (isIntPos(pos2)) {
-            return Land.SYMBOLS.Land_isCollision2(this.mLandId, pos1, pos2);
+            return Land.SYMBOLS.Land_isCollision2(this.ref, pos1, pos2);
         }
         throw new TypeError("pos2 must be IntPos or number");
     }
@@ -517,14 +821,14 @@ export class Land {
      * @note 调用 save 方法时，数据会被保存到数据库，并重置为未修改
      */
     isDirty(): boolean {
-        return Land.SYMBOLS.Land_isDirty(this.mLandId);
+        return Land.SYMBOLS.Land_isDirty(this.ref);
     }
 
     /**
      * @brief 获取领地类型
      */
     getType(): LandType | null {
-        const result = Land.SYMBOLS.Land_getType(this.mLandId);
+        const result = Land.SYMBOLS.Land_getType(this.ref);
         if (result === INVALID_LAND_ID) {
             return null;
         }
@@ -535,42 +839,42 @@ export class Land {
      * @brief 是否有父领地
      */
     hasParentLand(): boolean {
-        return Land.SYMBOLS.Land_hasParentLand(this.mLandId);
+        return Land.SYMBOLS.Land_hasParentLand(this.ref);
     }
 
     /**
      * @brief 是否有子领地
      */
     hasSubLand(): boolean {
-        return Land.SYMBOLS.Land_hasSubLand(this.mLandId);
+        return Land.SYMBOLS.Land_hasSubLand(this.ref);
     }
 
     /**
      * @brief 是否为子领地(有父领地、无子领地)
      */
     isSubLand(): boolean {
-        return Land.SYMBOLS.Land_isSubLand(this.mLandId);
+        return Land.SYMBOLS.Land_isSubLand(this.ref);
     }
 
     /**
      * @brief 是否为父领地(有子领地、无父领地)
      */
     isParentLand(): boolean {
-        return Land.SYMBOLS.Land_isParentLand(this.mLandId);
+        return Land.SYMBOLS.Land_isParentLand(this.ref);
     }
 
     /**
      * @brief 是否为混合领地(有父领地、有子领地)
      */
     isMixLand(): boolean {
-        return Land.SYMBOLS.Land_isMixLand(this.mLandId);
+        return Land.SYMBOLS.Land_isMixLand(this.ref);
     }
 
     /**
      * @brief 是否为普通领地(无父领地、无子领地)
      */
     isOrdinaryLand(): boolean {
-        return Land.SYMBOLS.Land_isOrdinaryLand(this.mLandId);
+        return Land.SYMBOLS.Land_isOrdinaryLand(this.ref);
     }
 
     /**
@@ -578,14 +882,14 @@ export class Land {
      * 如果满足嵌套层级限制，则可以创建子领地
      */
     canCreateSubLand(): boolean {
-        return Land.SYMBOLS.Land_canCreateSubLand(this.mLandId);
+        return Land.SYMBOLS.Land_canCreateSubLand(this.ref);
     }
 
     /**
      * @brief 获取父领地
      */
     getParentLandID(): Land | null {
-        const result = Land.SYMBOLS.Land_getParentLandID(this.mLandId);
+        const result = Land.SYMBOLS.Land_getParentLandID(this.ref);
         if (result === -1) {
             return null;
         }
@@ -596,7 +900,7 @@ export class Land {
      * @brief 获取子领地(当前领地名下的所有子领地)
      */
     getSubLandIDs(): Land[] {
-        return Land.SYMBOLS.Land_getSubLandIDs(this.mLandId).map(
+        return Land.SYMBOLS.Land_getSubLandIDs(this.ref).map(
             (id) => new Land(id)
         );
     }
@@ -605,14 +909,14 @@ export class Land {
      * @brief 获取嵌套层级(相对于父领地)
      */
     getNestedLevel(): number {
-        return Land.SYMBOLS.Land_getNestedLevel(this.mLandId);
+        return Land.SYMBOLS.Land_getNestedLevel(this.ref);
     }
 
     /**
      * @brief 获取一个玩家在当前领地所拥有的权限类别
      */
     getPermType(uuid: UUID): LandPermType {
-        return Land.SYMBOLS.Land_getPermType(this.mLandId, uuid);
+        return Land.SYMBOLS.Land_getPermType(this.ref, uuid);
     }
 }
 
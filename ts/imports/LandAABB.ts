@@ -2,6 +2,112 @@ import {importSymbol, ImportNamespace} from "../ImportDef.js";
 
 type FixedArray<T, L extends number> = [T, ...T[]] & { length: L };
 
+/**
+ * 方块列: x/z 固定, y 从 yFrom 到 yTo (含)
+ */
+export type RangeRun = [x: number, z: number, yFrom: number, yTo: number];
+
+export enum Axis {
+    X = 0,
+    Y = 1,
+    Z = 2,
+}
+
+/**
+ * 边框线段: 起点、终点、所在轴，以及按抽样步长计算的点数 (含两端)
+ */
+export type BorderSegment = [
+    x0: number, y0: number, z0: number,
+    x1: number, y1: number, z1: number,
+    axis: Axis,
+    count: number,
+];
+
+/**
+ * 原生侧游标状态
+ * @note Invalid: 句柄已关闭、从未打开，或结束记录已被遗忘 (原生侧只保留最近 1024 个已结束游标的状态)
+ */
+export enum RangeCursorState {
+    Invalid = -1,
+    Active = 0,
+    Finished = 1,
+    Evicted = 2,
+}
+
+/**
+ * AABB 范围游标，分段获取范围内的方块坐标，避免一次性生成整个范围
+ * @note 遍历完毕后游标会自动释放，提前结束遍历时请调用 close()
+ * @note 同时打开的游标过多时最早的游标会被原生侧淘汰，此后 next / nextRuns 抛出异常 (句柄失效时同样抛出)
+ */
+export class LandAABBRangeCursor {
+    private handle: number;
+    private done = false;
+
+    constructor(handle: number) {
+        this.handle = handle;
+    }
+
+    /**
+     * 获取下一段坐标
+     * @param maxCount 本次最多返回的坐标数量
+     * @returns 坐标列表，遍历完毕时返回空数组
+     */
+    next(maxCount = 4096): IntPos[] {
+        if (this.done) {
+            return [];
+        }
+        const res = LandAABB.IMPORTS.LandAABB_nextRange(this.handle, maxCount);
+        this.checkEnd(res.length);
+        return res;
+    }
+
+    /**
+     * 以列为单位获取下一段范围
+     * @param maxCount 本次最多返回的列数量
+     * @returns 列列表，遍历完毕时返回空数组
+     */
+    nextRuns(maxCount = 4096): RangeRun[] {
+        if (this.done) {
+            return [];
+        }
+        const res = LandAABB.IMPORTS.LandAABB_nextRangeRuns(this.handle, maxCount);
+        this.checkEnd(res.length);
+        return res;
+    }
+
+    private checkEnd(length: number): void {
+        this.done = length === 0;
+        if (!this.done) {
+            return;
+        }
+        const state = LandAABB.IMPORTS.LandAABB_getRangeState(this.handle);
+        if (state === RangeCursorState.Evicted) {
+            LandAABB.IMPORTS.LandAABB_closeRange(this.handle);
+            throw new Error("LandAABBRangeCursor: cursor was evicted, too many ranges open at once");
+        }
+        if (state === RangeCursorState.Invalid) {
+            throw new Error("LandAABBRangeCursor: cursor handle is no longer valid");
+        }
+    }
+
+    close(): void {
+        if (!this.done) {
+            LandAABB.IMPORTS.LandAABB_closeRange(this.handle);
+            this.done = true;
+        }
+    }
+
+    *[Symbol.iterator](): IterableIterator<IntPos> {
+        try {
+            for (let chunk = this.next(); chunk.length > 0; chunk = this.next()) {
+                yield* chunk;
+            }
+        } finally {
+            this.close();
+        }
+    }
+}
+
 export class LandAABB {
     // 导入表，请勿修改
     static IMPORTS = {
@@ -23,6 +129,12 @@ export class LandAABB {
         LandAABB_toString: ll.imports(ImportNamespace, "LandAABB_toString"),
         LandAABB_getBorder: ll.imports(ImportNamespace, "LandAABB_getBorder"),
         LandAABB_getRange: ll.imports(ImportNamespace, "LandAABB_getRange"),
+        LandAABB_openRange: importSymbol("LandAABB_openRange") as (a: IntPos, b: IntPos) => number,
+        LandAABB_nextRange: importSymbol("LandAABB_nextRange") as (handle: number, maxCount: number) => IntPos[],
+        LandAABB_nextRangeRuns: importSymbol("LandAABB_nextRangeRuns") as (handle: number, maxCount: number) => RangeRun[],
+        LandAABB_closeRange: importSymbol("LandAABB_closeRange") as (handle: number) => void,
+        LandAABB_getRangeState: importSymbol("LandAABB_getRangeState") as (handle: number) => RangeCursorState,
+        LandAABB_getBorderSegments: importSymbol("LandAABB_getBorderSegments") as (a: IntPos, b: IntPos, step: number) => BorderSegment[],
         LandAABB_getVertices: importSymbol("LandAABB_getVertices") as (a: IntPos, b: IntPos) => FixedArray<FloatPos, 4>,
         LandAABB_getCorners: importSymbol("LandAABB_getCorners") as (a: IntPos, b: IntPos) => FixedArray<FloatPos, 8>,
         LandAABB_getEdges: importSymbol("LandAABB_getEdges") as (a: IntPos, b: IntPos) => Array<FixedArray<FloatPos, 2>>,
@@ -112,14 +224,31 @@ export class LandAABB {
         return LandAABB.IMPORTS.LandAABB_getBorder(this.min, this.max);
     }
 
+    /**
+     * 获取领地边框线段 (立体矩形的棱)
+     * @param step 抽样步长，影响每条线段的 count
+     * @returns 线段列表，数量只与棱数相关，与周长无关
+     */
+    getBorderSegments(step = 1): BorderSegment[] {
+        return LandAABB.IMPORTS.LandAABB_getBorderSegments(this.min, this.max, step);
+    }
+
     /**
      * 获取领地范围 (平面矩形)
      * @returns 领地范围点列表
+     * @note 大范围请使用 openRange() 分段获取
      */
     getRange(): IntPos[] {
         return LandAABB.IMPORTS.LandAABB_getRange(this.min, this.max);
     }
 
+    /**
+     * 打开范围游标，分段获取范围内的方块坐标
+     */
+    openRange(): LandAABBRangeCursor {
+        return new LandAABBRangeCursor(LandAABB.IMPORTS.LandAABB_openRange(this.min, this.max));
+    }
+
     /**
      * @brief 获取 AABB 区域的顶点坐标 (4个角点，平面)
      */
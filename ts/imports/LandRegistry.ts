@@ -5,7 +5,7 @@ import {
     isIntPos,
     LandID,
     LandPermType,
-    UUID, InternalLandAABB, FfiProtocol, asExpected,
+    UUID, InternalLandAABB, FfiProtocol, FfiNativeProtocol, invokeFfi,
 } from "../ImportDef.js";
 import {LandAABB} from "./LandAABB.js";
 import {Land} from "./Land.js";
@@ -18,6 +18,57 @@ export type PlayerSettings = {
     /** 是否持续显示底部提示 */ showBottomContinuedTip: boolean;
 };
 
+export interface UUIDCacheStats {
+    parseHits: number;
+    parseMisses: number;
+    formatHits: number;
+    formatMisses: number;
+    entries: number;
+}
+
+/** 领地变更类型，LandChanges 中的 kinds 为 1 << LandChangeKind 的组合 */
+export enum LandChangeKind {
+    Created = 0,
+    Removed = 1,
+    Resized = 2,
+    OwnerChanged = 3,
+    MembersChanged = 4,
+    StateChanged = 5,
+}
+
+export interface LandChanges {
+    /** 当前版本，下次以此调用 changesSince */
+    version: number;
+    /** 请求的版本已不在日志中 (或传入了负数)，需要全量同步 */
+    resync: boolean;
+    /** 每块变更过的领地一项 (按首次变更的顺序) */
+    lands: { id: LandID; kinds: number }[];
+}
+
+/** 拟建范围与已有领地的冲突类型 */
+export enum LandConflictType {
+    /** 范围重叠 */
+    Overlap = 0,
+    /** 未重叠，但间距小于 minSpacing */
+    Spacing = 1,
+    /** 一方完全包含另一方 */
+    Containment = 2,
+}
+
+export interface LandConflict {
+    id: LandID;
+    type: LandConflictType;
+}
+
+export interface OwnerIndexStats {
+    queries: number;
+    mismatches: number;
+    players: number;
+    lands: number;
+    /** 查询时回查注册表发现并修正的失效条目数 (漏掉删除 / 转出等变更通知时增加；漏掉的新增只有校验模式能发现) */
+    stale: number;
+}
+
 export class LandRegistry {
     static IMPORTS = {
         LandRegistry_isOperator: importSymbol("LandRegistry_isOperator"),
@@ -34,10 +85,19 @@ export class LandRegistry {
         LandRegistry_getLands2: importSymbol("LandRegistry_getLands2"),
         LandRegistry_getLands3: importSymbol("LandRegistry_getLands3"),
         LandRegistry_getLands4: importSymbol("LandRegistry_getLands4"),
+        LandRegistry_getGeneration: importSymbol("LandRegistry_getGeneration") as () => number,
+        LandRegistry_changesSince: importSymbol("LandRegistry_changesSince") as (version: number) => number[],
         LandRegistry_getPermType: importSymbol("LandRegistry_getPermType"),
         LandRegistry_getLandAt: importSymbol("LandRegistry_getLandAt"),
         LandRegistry_getLandAt1: importSymbol("LandRegistry_getLandAt1"),
         LandRegistry_getLandAt2: importSymbol("LandRegistry_getLandAt2"),
+        LandRegistry_findConflicts: importSymbol("LandRegistry_findConflicts") as (
+            pos1: IntPos,
+            pos2: IntPos,
+            minSpacing: number,
+            includeY: boolean,
+            ignoreIds: LandID[],
+        ) => number[],
         LandRegistry_refreshLandRange: importSymbol(
             "LandRegistry_refreshLandRange",
         ),
@@ -45,9 +105,20 @@ export class LandRegistry {
         LandRegistry_removeOrdinaryLand: importSymbol(
             "LandRegistry_removeOrdinaryLand",
         ) as (id: LandID) => FfiProtocol,
+        LandRegistry_removeOrdinaryLand_Native: importSymbol(
+            "LandRegistry_removeOrdinaryLand_Native",
+        ) as (id: LandID) => FfiNativeProtocol,
         LandRegistry_addOrdinaryLand: importSymbol("LandRegistry_addOrdinaryLand") as (aabb: InternalLandAABB, is3D: boolean, owner: UUID) => FfiProtocol,
+        LandRegistry_addOrdinaryLand_Native: importSymbol("LandRegistry_addOrdinaryLand_Native") as (aabb: InternalLandAABB, is3D: boolean, owner: UUID) => FfiNativeProtocol,
 
         LandRegistry_createSnapshot: importSymbol("LandRegistry_createSnapshot") as (dirName?: string) => void,
+
+        UUIDCache_getStats: importSymbol("UUIDCache_getStats") as () => number[],
+
+        LandRegistry_setOwnerIndexCrossCheck: importSymbol("LandRegistry_setOwnerIndexCrossCheck") as (enabled: boolean) => void,
+        LandRegistry_setLandListCrossCheck: importSymbol("LandRegistry_setLandListCrossCheck") as (enabled: boolean) => void,
+        LandRegistry_getLandListMismatches: importSymbol("LandRegistry_getLandListMismatches") as () => number,
+        LandRegistry_getOwnerIndexStats: importSymbol("LandRegistry_getOwnerIndexStats") as () => number[],
     };
 
     constructor() {
@@ -112,12 +183,13 @@ export class LandRegistry {
         if (aabb.min.dimid != aabb.max.dimid) {
             throw new Error("AABB min and max must be in the same dimension");
         }
-        const protocol = LandRegistry.IMPORTS.LandRegistry_addOrdinaryLand(
+        return invokeFfi<LandID>(
+            LandRegistry.IMPORTS.LandRegistry_addOrdinaryLand,
+            LandRegistry.IMPORTS.LandRegistry_addOrdinaryLand_Native,
             [aabb.min, aabb.max],
             is3D,
             owner,
-        );
-        return asExpected<LandID>(protocol).map(id => new Land(id));
+        ).map(id => new Land(id));
     }
 
     /**
@@ -131,8 +203,11 @@ export class LandRegistry {
                 ? land
                 :
                 (land as Land).mLandId;
-        const protocol = LandRegistry.IMPORTS.LandRegistry_removeOrdinaryLand(id);
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LandRegistry.IMPORTS.LandRegistry_removeOrdinaryLand,
+            LandRegistry.IMPORTS.LandRegistry_removeOrdinaryLand_Native,
+            id,
+        );
     }
 
     static getLand(landID: LandID): Land | null {
@@ -267,6 +342,11 @@ export class LandRegistry {
         }
     }
 
+    /**
+     * 获取玩家在领地中的权限类型
+     * @param landID 领地 ID 或句柄
+     * @returns 领地不存在或句柄已失效时返回 -1
+     */
     static getPermType(
         uuid: UUID,
         landID = 0,
@@ -279,6 +359,54 @@ export class LandRegistry {
         );
     }
 
+    /**
+     * 领地增删 / 范围变化时递增的代数，与上次相同时 getLands() / getLands(dimid) 的结果不变
+     */
+    static getGeneration(): number {
+        return LandRegistry.IMPORTS.LandRegistry_getGeneration();
+    }
+
+    /**
+     * 获取 version 之后的领地变更 (按领地合并)
+     * 首次同步时传入 -1，全量同步后以返回的 version 继续增量查询
+     */
+    static changesSince(version: number): LandChanges {
+        const [current, resync, ...flat] = LandRegistry.IMPORTS.LandRegistry_changesSince(version);
+        const lands: { id: LandID; kinds: number }[] = [];
+        for (let i = 0; i + 1 < flat.length; i += 2) {
+            lands.push({id: flat[i], kinds: flat[i + 1]});
+        }
+        return {version: current, resync: resync === 1, lands};
+    }
+
+    /**
+     * 检查拟建范围与同维度已有领地的冲突 (重叠、包含、间距不足)，结果按领地 ID 升序
+     * @param aabb 拟建范围，维度取 aabb.min.dimid
+     * @param minSpacing 最小间距
+     * @param includeY 间距与重叠是否考虑 Y 轴
+     * @param ignore 不参与检查的领地 (例如调整范围时的领地自身)
+     */
+    static findConflicts(
+        aabb: LandAABB,
+        minSpacing = 0,
+        includeY = true,
+        ignore: (Land | LandID)[] = [],
+    ): LandConflict[] {
+        const ignoreIds = ignore.map((land) => (typeof land === "number" ? land : land.mLandId));
+        const flat = LandRegistry.IMPORTS.LandRegistry_findConflicts(
+            aabb.min,
+            aabb.max,
+            minSpacing,
+            includeY,
+            ignoreIds,
+        );
+        const conflicts: LandConflict[] = [];
+        for (let i = 0; i + 1 < flat.length; i += 2) {
+            conflicts.push({id: flat[i], type: flat[i + 1]});
+        }
+        return conflicts;
+    }
+
     static refreshLandRange(land: Land): void {
         // @ts-ignore
         LandRegistry.IMPORTS.LandRegistry_refreshLandRange(land.unique_id);
@@ -291,6 +419,46 @@ export class LandRegistry {
     } {
         return JSON.parse(LandRegistry.IMPORTS.PLand_getVersionMeta());
     }
+
+    /**
+     * 获取原生侧 UUID 解析 / 格式化缓存的命中统计
+     */
+    static getUUIDCacheStats(): UUIDCacheStats {
+        const [parseHits, parseMisses, formatHits, formatMisses, entries] =
+            LandRegistry.IMPORTS.UUIDCache_getStats();
+        return {parseHits, parseMisses, formatHits, formatMisses, entries};
+    }
+
+    /**
+     * 开启后 getLands(uuid, ...) 的每次查询都会与注册表的全表遍历结果比对 (仅用于排查索引问题)
+     * @note 未开启时查询只会剔除失效的结果，漏掉变更通知而缺失的领地只能由此模式发现并修正
+     */
+    static setOwnerIndexCrossCheck(enabled: boolean): void {
+        LandRegistry.IMPORTS.LandRegistry_setOwnerIndexCrossCheck(enabled);
+    }
+
+    /**
+     * 开启后 getLands() / getLands(dimid) / getGeneration() 的每次读取都会抽查少量领地 ID，
+     * 发现漏掉的创建 / 删除时从注册表重建 (仅用于排查，会给读取路径增加注册表查询)
+     */
+    static setLandListCrossCheck(enabled: boolean): void {
+        LandRegistry.IMPORTS.LandRegistry_setLandListCrossCheck(enabled);
+    }
+
+    /**
+     * 领地列表缓存在校验模式下发现不一致并重建的次数
+     */
+    static getLandListMismatches(): number {
+        return LandRegistry.IMPORTS.LandRegistry_getLandListMismatches();
+    }
+
+    /**
+     * 获取主人 / 成员反向索引的统计，mismatches 为校验模式下发现的不一致次数
+     */
+    static getOwnerIndexStats(): OwnerIndexStats {
+        const [queries, mismatches, players, lands, stale] = LandRegistry.IMPORTS.LandRegistry_getOwnerIndexStats();
+        return {queries, mismatches, players, lands, stale};
+    }
 }
 
 Object.freeze(LandRegistry.IMPORTS);
@@ -0,0 +1,42 @@
+import {Expected, FfiNativeProtocol, FfiProtocol, importSymbol, invokeFfi} from "../ImportDef.js";
+
+/**
+ * 录制导出函数调用与事件派发的时间线 (Chrome trace JSON，可在 Perfetto 中打开)
+ * 也可在控制台使用 `ldapi trace start|stop`
+ * @note 仅在以 LDAPI_INSTRUMENTATION 编译 (debug 模式或 xmake f --ldapi_instrumentation=y) 时可用
+ */
+export class Trace {
+    constructor() {
+        throw new Error("Cannot create an instance of Trace");
+    }
+
+    static SYMBOLS = {
+        Trace_start: importSymbol("Trace_start") as (capacity: number) => boolean,
+        Trace_isRecording: importSymbol("Trace_isRecording") as () => boolean,
+        Trace_stop: importSymbol("Trace_stop") as (path: string) => FfiProtocol,
+        Trace_stop_Native: importSymbol("Trace_stop_Native") as (path: string) => FfiNativeProtocol,
+    }
+
+    /**
+     * 开始录制
+     * @param capacity 环形缓冲容量 (事件数)，写满后覆盖最旧的记录；0 为默认值 (262144)，上限 4194304
+     * @returns 已在录制或未启用 LDAPI_INSTRUMENTATION 时返回 false
+     */
+    static start(capacity: number = 0): boolean {
+        return Trace.SYMBOLS.Trace_start(capacity);
+    }
+
+    static isRecording(): boolean {
+        return Trace.SYMBOLS.Trace_isRecording();
+    }
+
+    /**
+     * 停止录制并写出 trace 文件
+     * @returns 写出的事件数
+     */
+    static stop(path: string): Expected<number> {
+        return invokeFfi<number>(Trace.SYMBOLS.Trace_stop, Trace.SYMBOLS.Trace_stop_Native, path);
+    }
+}
+
+Object.freeze(Trace.SYMBOLS);
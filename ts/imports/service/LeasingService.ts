@@ -1,4 +1,4 @@
-import {asExpected, Expected, FfiProtocol, importSymbol, LandID} from "../../ImportDef.js";
+import {Expected, FfiNativeProtocol, FfiProtocol, importSymbol, invokeFfi, LandID} from "../../ImportDef.js";
 import {Land} from "../Land.js";
 
 export class LeasingService {
@@ -10,13 +10,21 @@ export class LeasingService {
         LeasingService_enabled: importSymbol("LeasingService_enabled") as () => boolean,
         LeasingService_refreshSchedule: importSymbol("LeasingService_refreshSchedule") as (landId: number) => void,
         LeasingService_setStartAt: importSymbol("LeasingService_setStartAt") as (landId: number, timestamp: string) => FfiProtocol,
+        LeasingService_setStartAt_Native: importSymbol("LeasingService_setStartAt_Native") as (landId: number, timestamp: string) => FfiNativeProtocol,
         LeasingService_setEndAt: importSymbol("LeasingService_setEndAt") as (landId: number, timestamp: string) => FfiProtocol,
+        LeasingService_setEndAt_Native: importSymbol("LeasingService_setEndAt_Native") as (landId: number, timestamp: string) => FfiNativeProtocol,
         LeasingService_forceFreeze: importSymbol("LeasingService_forceFreeze") as (landId: number) => FfiProtocol,
+        LeasingService_forceFreeze_Native: importSymbol("LeasingService_forceFreeze_Native") as (landId: number) => FfiNativeProtocol,
         LeasingService_forceRecycle: importSymbol("LeasingService_forceRecycle") as (landId: number) => FfiProtocol,
+        LeasingService_forceRecycle_Native: importSymbol("LeasingService_forceRecycle_Native") as (landId: number) => FfiNativeProtocol,
         LeasingService_addTime: importSymbol("LeasingService_addTime") as (landId: number, sec: number) => FfiProtocol,
+        LeasingService_addTime_Native: importSymbol("LeasingService_addTime_Native") as (landId: number, sec: number) => FfiNativeProtocol,
         LeasingService_cleanExpiredLands: importSymbol("LeasingService_cleanExpiredLands") as (daysOverdue: number) => FfiProtocol,
+        LeasingService_cleanExpiredLands_Native: importSymbol("LeasingService_cleanExpiredLands_Native") as (daysOverdue: number) => FfiNativeProtocol,
         LeasingService_toBought: importSymbol("LeasingService_toBought") as (landId: number) => FfiProtocol,
+        LeasingService_toBought_Native: importSymbol("LeasingService_toBought_Native") as (landId: number) => FfiNativeProtocol,
         LeasingService_toLeased: importSymbol("LeasingService_toLeased") as (landId: number, days: number) => FfiProtocol,
+        LeasingService_toLeased_Native: importSymbol("LeasingService_toLeased_Native") as (landId: number, days: number) => FfiNativeProtocol,
     }
 
     /**
@@ -43,8 +51,12 @@ export class LeasingService {
     static setStartAt(land: Land | LandID, date: Date): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
         const timestamp = date.getTime() / 1000; // 转换为秒
-        const protocol = LeasingService.SYMBOLS.LeasingService_setStartAt(id, timestamp.toString());
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_setStartAt,
+            LeasingService.SYMBOLS.LeasingService_setStartAt_Native,
+            id,
+            timestamp.toString()
+        );
     }
 
     /**
@@ -55,8 +67,12 @@ export class LeasingService {
     static setEndAt(land: Land | LandID, date: Date): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
         const timestamp = date.getTime() / 1000; // 转换为秒
-        const protocol = LeasingService.SYMBOLS.LeasingService_setEndAt(id, timestamp.toString());
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_setEndAt,
+            LeasingService.SYMBOLS.LeasingService_setEndAt_Native,
+            id,
+            timestamp.toString()
+        );
     }
 
     /**
@@ -65,8 +81,11 @@ export class LeasingService {
      */
     forceFreeze(land: Land | LandID): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
-        const protocol = LeasingService.SYMBOLS.LeasingService_forceFreeze(id);
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_forceFreeze,
+            LeasingService.SYMBOLS.LeasingService_forceFreeze_Native,
+            id
+        );
     }
 
     /**
@@ -75,8 +94,11 @@ export class LeasingService {
      */
     forceRecycle(land: Land | LandID): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
-        const protocol = LeasingService.SYMBOLS.LeasingService_forceRecycle(id);
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_forceRecycle,
+            LeasingService.SYMBOLS.LeasingService_forceRecycle_Native,
+            id
+        );
     }
 
     /**
@@ -86,8 +108,12 @@ export class LeasingService {
      */
     addTime(land: Land | LandID, seconds: number): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
-        const protocol = LeasingService.SYMBOLS.LeasingService_addTime(id, seconds);
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_addTime,
+            LeasingService.SYMBOLS.LeasingService_addTime_Native,
+            id,
+            seconds
+        );
     }
 
     /**
@@ -96,8 +122,11 @@ export class LeasingService {
      * @return 返回清理的领地数量
      */
     cleanExpiredLands(daysOverdue: number): Expected<number> {
-        const protocol = LeasingService.SYMBOLS.LeasingService_cleanExpiredLands(daysOverdue);
-        return asExpected<number>(protocol);
+        return invokeFfi<number>(
+            LeasingService.SYMBOLS.LeasingService_cleanExpiredLands,
+            LeasingService.SYMBOLS.LeasingService_cleanExpiredLands_Native,
+            daysOverdue
+        );
     }
 
     /**
@@ -106,8 +135,11 @@ export class LeasingService {
      */
     toBought(land: Land | LandID): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
-        const protocol = LeasingService.SYMBOLS.LeasingService_toBought(id);
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_toBought,
+            LeasingService.SYMBOLS.LeasingService_toBought_Native,
+            id
+        );
     }
 
     /**
@@ -117,8 +149,12 @@ export class LeasingService {
      */
     toLeased(land: Land | LandID, days: number): Expected<void> {
         const id = typeof land === "number" ? land : land.mLandId;
-        const protocol = LeasingService.SYMBOLS.LeasingService_toLeased(id, days);
-        return asExpected<void>(protocol);
+        return invokeFfi<void>(
+            LeasingService.SYMBOLS.LeasingService_toLeased,
+            LeasingService.SYMBOLS.LeasingService_toLeased_Native,
+            id,
+            days
+        );
     }
 }
 
@@ -12,6 +12,12 @@ add_requires("legacyremotecall 0.19.0")
 
 add_requires("pland 0.21.0")
 
+option("ldapi_instrumentation")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Wrap exports for call metrics and allow trace recording (always on in debug mode)")
+option_end()
+
 if not has_config("vs_runtime") then
     set_runtimes("MD")
 end
@@ -50,5 +56,8 @@ target("PLand-LegacyRemoteCallApi") -- Change this to your mod name.
     add_defines("LL_PLAT_S")
 
     if is_mode("debug") then
-        add_defines("LDAPI_COLLECT_EXPORT_SYMBOLS")
+        add_defines("LDAPI_COLLECT_EXPORT_SYMBOLS", "LDAPI_CALL_METRICS")
+    end
+    if is_mode("debug") or has_config("ldapi_instrumentation") then
+        add_defines("LDAPI_INSTRUMENTATION")
     end
\ No newline at end of file